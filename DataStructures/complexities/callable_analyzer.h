@@ -0,0 +1,207 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/sorts.h>
+#include <libds/amt/explicit_sequence.h>
+#include <libds/amt/implicit_sequence.h>
+#include <functional>
+#include <random>
+
+namespace ds::utils
+{
+    /**
+     * @brief Common base for analyzers comparing std::function with templated callables.
+     * Every step appends step size random elements, so 10M elements are reached
+     * for example with step size 1'000'000 and step count 10.
+     */
+    template<class Sequence>
+    class CallableAnalyzer : public ComplexityAnalyzer<Sequence>
+    {
+    protected:
+        explicit CallableAnalyzer(const std::string& name);
+
+    protected:
+        void shuffle(Sequence& sequence);
+        long long getResult() const;
+        void setResult(long long result);
+
+    private:
+        void insertNElements(Sequence& sequence, size_t n);
+
+    private:
+        std::default_random_engine rngData_;
+        long long result_;
+    };
+
+    /**
+     * @brief Analyzes the traversal of all blocks with processAllBlocksForward.
+     */
+    template<class Sequence>
+    class FunctionTraversalAnalyzer : public CallableAnalyzer<Sequence>
+    {
+    public:
+        explicit FunctionTraversalAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes the traversal of all blocks with forEach.
+     */
+    template<class Sequence>
+    class TemplateTraversalAnalyzer : public CallableAnalyzer<Sequence>
+    {
+    public:
+        explicit TemplateTraversalAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes sorting by @p SortType with a comparator wrapped in std::function.
+     */
+    template<class SortType>
+    class FunctionSortAnalyzer : public CallableAnalyzer<amt::IS<int>>
+    {
+    public:
+        explicit FunctionSortAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(amt::IS<int>& structure) override;
+        void afterOperation(amt::IS<int>& structure) override;
+    };
+
+    /**
+     * @brief Analyzes sorting by @p SortType with a comparator passed as a template argument.
+     */
+    template<class SortType>
+    class TemplateSortAnalyzer : public CallableAnalyzer<amt::IS<int>>
+    {
+    public:
+        explicit TemplateSortAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(amt::IS<int>& structure) override;
+        void afterOperation(amt::IS<int>& structure) override;
+    };
+
+    /**
+     * @brief Container for all analyzers of callables.
+     */
+    class CallablesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        CallablesAnalyzer() :
+            CompositeAnalyzer("Callables")
+        {
+            this->addAnalyzer(std::make_unique<FunctionTraversalAnalyzer<amt::IS<int>>>("is-function-traversal"));
+            this->addAnalyzer(std::make_unique<TemplateTraversalAnalyzer<amt::IS<int>>>("is-template-traversal"));
+            this->addAnalyzer(std::make_unique<FunctionTraversalAnalyzer<amt::SinglyLS<int>>>("sls-function-traversal"));
+            this->addAnalyzer(std::make_unique<TemplateTraversalAnalyzer<amt::SinglyLS<int>>>("sls-template-traversal"));
+            this->addAnalyzer(std::make_unique<FunctionSortAnalyzer<adt::QuickSort<int>>>("quick-sort-function"));
+            this->addAnalyzer(std::make_unique<TemplateSortAnalyzer<adt::QuickSort<int>>>("quick-sort-template"));
+        }
+    };
+
+    template<class Sequence>
+    CallableAnalyzer<Sequence>::CallableAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Sequence>(name, [this](Sequence& sequence, size_t n) { this->insertNElements(sequence, n); }),
+        rngData_(std::random_device()()),
+        result_(0)
+    {
+    }
+
+    template<class Sequence>
+    void CallableAnalyzer<Sequence>::shuffle(Sequence& sequence)
+    {
+        sequence.forEach([this](auto* block) { block->data_ = static_cast<int>(rngData_()); });
+    }
+
+    template<class Sequence>
+    long long CallableAnalyzer<Sequence>::getResult() const
+    {
+        return result_;
+    }
+
+    template<class Sequence>
+    void CallableAnalyzer<Sequence>::setResult(long long result)
+    {
+        result_ = result;
+    }
+
+    template<class Sequence>
+    void CallableAnalyzer<Sequence>::insertNElements(Sequence& sequence, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            sequence.insertLast().data_ = static_cast<int>(rngData_());
+        }
+    }
+
+    template<class Sequence>
+    FunctionTraversalAnalyzer<Sequence>::FunctionTraversalAnalyzer(const std::string& name) :
+        CallableAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void FunctionTraversalAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        long long sum = 0;
+        structure.processAllBlocksForward([&sum](auto* block) { sum += block->data_; });
+        this->setResult(sum);
+    }
+
+    template<class Sequence>
+    TemplateTraversalAnalyzer<Sequence>::TemplateTraversalAnalyzer(const std::string& name) :
+        CallableAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void TemplateTraversalAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        long long sum = 0;
+        structure.forEach([&sum](auto* block) { sum += block->data_; });
+        this->setResult(sum);
+    }
+
+    template<class SortType>
+    FunctionSortAnalyzer<SortType>::FunctionSortAnalyzer(const std::string& name) :
+        CallableAnalyzer<amt::IS<int>>(name)
+    {
+    }
+
+    template<class SortType>
+    void FunctionSortAnalyzer<SortType>::executeOperation(amt::IS<int>& structure)
+    {
+        std::function<bool(const int&, const int&)> compare = std::less<int>();
+        SortType().sort(structure, compare);
+    }
+
+    template<class SortType>
+    void FunctionSortAnalyzer<SortType>::afterOperation(amt::IS<int>& structure)
+    {
+        this->shuffle(structure);
+    }
+
+    template<class SortType>
+    TemplateSortAnalyzer<SortType>::TemplateSortAnalyzer(const std::string& name) :
+        CallableAnalyzer<amt::IS<int>>(name)
+    {
+    }
+
+    template<class SortType>
+    void TemplateSortAnalyzer<SortType>::executeOperation(amt::IS<int>& structure)
+    {
+        SortType().sort(structure, [](const int& a, const int& b) { return a < b; });
+    }
+
+    template<class SortType>
+    void TemplateSortAnalyzer<SortType>::afterOperation(amt::IS<int>& structure)
+    {
+        this->shuffle(structure);
+    }
+}
@@ -0,0 +1,501 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <libds/amt/implicit_hierarchy.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Common base for analyzers of hierarchy traversals.
+     * Every new node is attached after a random descent from the root,
+     * so the hierarchy has random degrees and logarithmic expected depth.
+     */
+    template<class Hierarchy>
+    class HierarchyAnalyzer : public ComplexityAnalyzer<Hierarchy>
+    {
+    protected:
+        explicit HierarchyAnalyzer(const std::string& name);
+
+    protected:
+        long long getResult() const;
+        void setResult(long long result);
+
+    private:
+        void insertNNodes(Hierarchy& hierarchy, size_t n);
+
+    private:
+        std::default_random_engine rngData_;
+        long long result_;
+    };
+
+    /**
+     * @brief Analyzes the traversal of all nodes with the pre-order iterator.
+     */
+    template<class Hierarchy>
+    class PreOrderIteratorAnalyzer : public HierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit PreOrderIteratorAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+    };
+
+    /**
+     * @brief Analyzes the traversal of all nodes with the post-order iterator.
+     */
+    template<class Hierarchy>
+    class PostOrderIteratorAnalyzer : public HierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit PostOrderIteratorAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+    };
+
+    /**
+     * @brief Analyzes the traversal of all nodes with recursive processPreOrder.
+     */
+    template<class Hierarchy>
+    class PreOrderProcessAnalyzer : public HierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit PreOrderProcessAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+    };
+
+    /**
+     * @brief Analyzes the sum of all nodes computed by parallelReduce on the shared pool.
+     */
+    template<class Hierarchy>
+    class ParallelReduceAnalyzer : public HierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit ParallelReduceAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+    };
+
+    /**
+     * @brief Common base for analyzers of level and degree of all nodes of an implicit hierarchy.
+     */
+    template<class Hierarchy>
+    class ImplicitHierarchyAnalyzer : public ComplexityAnalyzer<Hierarchy>
+    {
+    protected:
+        explicit ImplicitHierarchyAnalyzer(const std::string& name);
+
+    protected:
+        size_t getResult() const;
+        void setResult(size_t result);
+
+    private:
+        size_t result_;
+    };
+
+    /**
+     * @brief Analyzes level of every node computed with floating point logarithms,
+     * as ImplicitHierarchy::level used to do.
+     */
+    template<class Hierarchy, size_t K>
+    class FloatingLevelAnalyzer : public ImplicitHierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit FloatingLevelAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+    };
+
+    /**
+     * @brief Analyzes level of every node computed one by one with level.
+     */
+    template<class Hierarchy>
+    class LevelAnalyzer : public ImplicitHierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit LevelAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+    };
+
+    /**
+     * @brief Analyzes level of every node computed at once with levels.
+     */
+    template<class Hierarchy>
+    class BatchLevelAnalyzer : public ImplicitHierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit BatchLevelAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+
+    private:
+        std::vector<size_t> levels_;
+    };
+
+    /**
+     * @brief Analyzes degree of every node computed one by one with degree.
+     */
+    template<class Hierarchy>
+    class DegreeAnalyzer : public ImplicitHierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit DegreeAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+    };
+
+    /**
+     * @brief Analyzes degree of every node computed at once with degrees.
+     */
+    template<class Hierarchy>
+    class BatchDegreeAnalyzer : public ImplicitHierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit BatchDegreeAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+
+    private:
+        std::vector<size_t> degrees_;
+    };
+
+    /**
+     * @brief Analyzes root to leaf searches in a binary implicit hierarchy
+     * whose nodes hold even keys in in-order, so it is a complete search tree.
+     * Every operation searches LOOKUP_COUNT random keys descending by indices.
+     */
+    template<class Hierarchy>
+    class ImplicitLookupAnalyzer : public ComplexityAnalyzer<Hierarchy>
+    {
+    public:
+        explicit ImplicitLookupAnalyzer(const std::string& name);
+
+    protected:
+        void beforeOperation(Hierarchy& structure) override;
+        void executeOperation(Hierarchy& structure) override;
+
+    private:
+        void insertNNodes(Hierarchy& hierarchy, size_t n);
+
+    private:
+        static constexpr size_t LOOKUP_COUNT = 1000;
+
+    private:
+        std::default_random_engine rngKey_;
+        std::vector<int> keys_;
+        size_t found_;
+    };
+
+    /**
+     * @brief Container for all analyzers of hierarchy traversals.
+     */
+    class HierarchiesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HierarchiesAnalyzer() :
+            CompositeAnalyzer("Hierarchies")
+        {
+            this->addAnalyzer(std::make_unique<PreOrderIteratorAnalyzer<amt::MultiWayEH<int>>>("mweh-pre-order-iterator"));
+            this->addAnalyzer(std::make_unique<PostOrderIteratorAnalyzer<amt::MultiWayEH<int>>>("mweh-post-order-iterator"));
+            this->addAnalyzer(std::make_unique<PreOrderProcessAnalyzer<amt::MultiWayEH<int>>>("mweh-pre-order-process"));
+            this->addAnalyzer(std::make_unique<ParallelReduceAnalyzer<amt::MultiWayEH<int>>>("mweh-parallel-reduce"));
+            this->addAnalyzer(std::make_unique<FloatingLevelAnalyzer<amt::BinaryIH<int>, 2>>("bih-level-floating"));
+            this->addAnalyzer(std::make_unique<LevelAnalyzer<amt::BinaryIH<int>>>("bih-level"));
+            this->addAnalyzer(std::make_unique<BatchLevelAnalyzer<amt::BinaryIH<int>>>("bih-level-batch"));
+            this->addAnalyzer(std::make_unique<FloatingLevelAnalyzer<amt::IH<int, 3>, 3>>("ih3-level-floating"));
+            this->addAnalyzer(std::make_unique<LevelAnalyzer<amt::IH<int, 3>>>("ih3-level"));
+            this->addAnalyzer(std::make_unique<BatchLevelAnalyzer<amt::IH<int, 3>>>("ih3-level-batch"));
+            this->addAnalyzer(std::make_unique<DegreeAnalyzer<amt::IH<int, 3>>>("ih3-degree"));
+            this->addAnalyzer(std::make_unique<BatchDegreeAnalyzer<amt::IH<int, 3>>>("ih3-degree-batch"));
+            this->addAnalyzer(std::make_unique<ImplicitLookupAnalyzer<amt::BinaryIH<int>>>("bih-lookup-level-order"));
+            this->addAnalyzer(std::make_unique<ImplicitLookupAnalyzer<amt::BinaryIH<int, amt::BlockedLayout<4>>>>("bih-lookup-blocked-4"));
+            this->addAnalyzer(std::make_unique<ImplicitLookupAnalyzer<amt::BinaryIH<int, amt::VanEmdeBoasLayout>>>("bih-lookup-van-emde-boas"));
+        }
+    };
+
+    template<class Hierarchy>
+    HierarchyAnalyzer<Hierarchy>::HierarchyAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Hierarchy>(name, [this](Hierarchy& hierarchy, size_t n) { this->insertNNodes(hierarchy, n); }),
+        rngData_(std::random_device()()),
+        result_(0)
+    {
+    }
+
+    template<class Hierarchy>
+    long long HierarchyAnalyzer<Hierarchy>::getResult() const
+    {
+        return result_;
+    }
+
+    template<class Hierarchy>
+    void HierarchyAnalyzer<Hierarchy>::setResult(long long result)
+    {
+        result_ = result;
+    }
+
+    template<class Hierarchy>
+    void HierarchyAnalyzer<Hierarchy>::insertNNodes(Hierarchy& hierarchy, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            auto* node = hierarchy.accessRoot();
+            if (node == nullptr)
+            {
+                hierarchy.emplaceRoot().data_ = static_cast<int>(rngData_());
+                continue;
+            }
+
+            while (true)
+            {
+                const size_t degree = hierarchy.degree(*node);
+                const size_t sonOrder = rngData_() % (degree + 1);
+                if (sonOrder == degree)
+                {
+                    hierarchy.emplaceSon(*node, degree).data_ = static_cast<int>(rngData_());
+                    break;
+                }
+                node = hierarchy.accessSon(*node, sonOrder);
+            }
+        }
+    }
+
+    template<class Hierarchy>
+    PreOrderIteratorAnalyzer<Hierarchy>::PreOrderIteratorAnalyzer(const std::string& name) :
+        HierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void PreOrderIteratorAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        long long sum = 0;
+        for (auto it = structure.beginPre(), end = structure.endPre(); it != end; ++it)
+        {
+            sum += *it;
+        }
+        this->setResult(sum);
+    }
+
+    template<class Hierarchy>
+    PostOrderIteratorAnalyzer<Hierarchy>::PostOrderIteratorAnalyzer(const std::string& name) :
+        HierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void PostOrderIteratorAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        long long sum = 0;
+        for (auto it = structure.beginPost(), end = structure.endPost(); it != end; ++it)
+        {
+            sum += *it;
+        }
+        this->setResult(sum);
+    }
+
+    template<class Hierarchy>
+    PreOrderProcessAnalyzer<Hierarchy>::PreOrderProcessAnalyzer(const std::string& name) :
+        HierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void PreOrderProcessAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        long long sum = 0;
+        structure.processPreOrder(structure.accessRoot(), [&sum](const auto* block) { sum += block->data_; });
+        this->setResult(sum);
+    }
+
+    template<class Hierarchy>
+    ParallelReduceAnalyzer<Hierarchy>::ParallelReduceAnalyzer(const std::string& name) :
+        HierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void ParallelReduceAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        this->setResult(structure.parallelReduce(
+            structure.accessRoot(),
+            [](const auto* block) { return static_cast<long long>(block->data_); },
+            [](long long left, long long right) { return left + right; }
+        ));
+    }
+
+    template<class Hierarchy>
+    ImplicitHierarchyAnalyzer<Hierarchy>::ImplicitHierarchyAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Hierarchy>(name, [](Hierarchy& hierarchy, size_t n)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    hierarchy.insertLastLeaf();
+                }
+            }),
+        result_(0)
+    {
+    }
+
+    template<class Hierarchy>
+    size_t ImplicitHierarchyAnalyzer<Hierarchy>::getResult() const
+    {
+        return result_;
+    }
+
+    template<class Hierarchy>
+    void ImplicitHierarchyAnalyzer<Hierarchy>::setResult(size_t result)
+    {
+        result_ = result;
+    }
+
+    template<class Hierarchy, size_t K>
+    FloatingLevelAnalyzer<Hierarchy, K>::FloatingLevelAnalyzer(const std::string& name) :
+        ImplicitHierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy, size_t K>
+    void FloatingLevelAnalyzer<Hierarchy, K>::executeOperation(Hierarchy& structure)
+    {
+        size_t sum = 0;
+        const size_t size = structure.size();
+        for (size_t index = 0; index < size; ++index)
+        {
+            sum += static_cast<size_t>(std::floor(std::log((K - 1) * (index + 1)) / std::log(K)));
+        }
+        this->setResult(sum);
+    }
+
+    template<class Hierarchy>
+    LevelAnalyzer<Hierarchy>::LevelAnalyzer(const std::string& name) :
+        ImplicitHierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void LevelAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        size_t sum = 0;
+        const size_t size = structure.size();
+        for (size_t index = 0; index < size; ++index)
+        {
+            sum += structure.level(index);
+        }
+        this->setResult(sum);
+    }
+
+    template<class Hierarchy>
+    BatchLevelAnalyzer<Hierarchy>::BatchLevelAnalyzer(const std::string& name) :
+        ImplicitHierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void BatchLevelAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        levels_.resize(structure.size());
+        structure.levels(0, structure.size(), levels_.begin());
+        this->setResult(levels_.empty() ? 0 : levels_.back());
+    }
+
+    template<class Hierarchy>
+    DegreeAnalyzer<Hierarchy>::DegreeAnalyzer(const std::string& name) :
+        ImplicitHierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void DegreeAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        size_t sum = 0;
+        const size_t size = structure.size();
+        for (size_t index = 0; index < size; ++index)
+        {
+            sum += structure.degree(index);
+        }
+        this->setResult(sum);
+    }
+
+    template<class Hierarchy>
+    BatchDegreeAnalyzer<Hierarchy>::BatchDegreeAnalyzer(const std::string& name) :
+        ImplicitHierarchyAnalyzer<Hierarchy>(name)
+    {
+    }
+
+    template<class Hierarchy>
+    void BatchDegreeAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        degrees_.resize(structure.size());
+        structure.degrees(0, structure.size(), degrees_.begin());
+        this->setResult(degrees_.empty() ? 0 : degrees_.back());
+    }
+
+    template<class Hierarchy>
+    ImplicitLookupAnalyzer<Hierarchy>::ImplicitLookupAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Hierarchy>(name, [this](Hierarchy& hierarchy, size_t n) { this->insertNNodes(hierarchy, n); }),
+        rngKey_(std::random_device()()),
+        found_(0)
+    {
+    }
+
+    template<class Hierarchy>
+    void ImplicitLookupAnalyzer<Hierarchy>::beforeOperation(Hierarchy& structure)
+    {
+        std::uniform_int_distribution<int> distribution(0, static_cast<int>(2 * structure.size()));
+        keys_.resize(LOOKUP_COUNT);
+        for (int& key : keys_)
+        {
+            key = distribution(rngKey_);
+        }
+    }
+
+    template<class Hierarchy>
+    void ImplicitLookupAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        const size_t size = structure.size();
+        for (int key : keys_)
+        {
+            size_t index = 0;
+            while (index < size)
+            {
+                const int nodeKey = structure.access(index)->data_;
+                if (nodeKey == key)
+                {
+                    ++found_;
+                    break;
+                }
+                index = structure.indexOfSon(index, key < nodeKey ? 0 : 1);
+            }
+        }
+    }
+
+    template<class Hierarchy>
+    void ImplicitLookupAnalyzer<Hierarchy>::insertNNodes(Hierarchy& hierarchy, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            hierarchy.insertLastLeaf();
+        }
+
+        int key = 0;
+        for (auto it = hierarchy.begin(), end = hierarchy.end(); it != end; ++it)
+        {
+            *it = key;
+            key += 2;
+        }
+    }
+}
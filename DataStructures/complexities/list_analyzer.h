@@ -1,6 +1,11 @@
 #pragma once
 
 #include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_sequence.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/amt/skip_list_sequence.h>
+#include <libds/amt/unrolled_linked_sequence.h>
+#include <cstddef>
 #include <iterator>
 #include <list>
 #include <random>
@@ -58,6 +63,88 @@ namespace ds::utils
         void executeOperation(List& structure) override;
     };
 
+    /**
+     * @brief Analyzes complexity of a burst of inserts at one position, as in text editing.
+     */
+    template<class List>
+    class ListCursorInsertAnalyzer : public ListAnalyzer<List>
+    {
+    public:
+        explicit ListCursorInsertAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(List& structure) override;
+
+    private:
+        static const size_t BURST_SIZE = 64;
+    };
+
+    /**
+     * @brief Analyzes complexity of visiting all elements by their index, one index after another.
+     */
+    template<class List>
+    class ListIndexLoopAnalyzer : public ListAnalyzer<List>
+    {
+    public:
+        explicit ListIndexLoopAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(List& structure) override;
+
+    private:
+        long long result_;
+    };
+
+    /**
+     * @brief Gives an implicit sequence the interface of std containers used by list analyzers.
+     */
+    template<class Sequence>
+    class SequenceListAdapter
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = int;
+            using difference_type = std::ptrdiff_t;
+            using pointer = int*;
+            using reference = int&;
+
+            iterator(Sequence* sequence, size_t index) : sequence_(sequence), index_(index) {}
+            iterator& operator++() { ++index_; return *this; }
+            iterator& operator--() { --index_; return *this; }
+            iterator& operator+=(difference_type n) { index_ += n; return *this; }
+            reference operator*() const { return sequence_->access(index_)->data_; }
+            bool operator==(const iterator& other) const { return index_ == other.index_; }
+            bool operator!=(const iterator& other) const { return index_ != other.index_; }
+            size_t getIndex() const { return index_; }
+
+        private:
+            Sequence* sequence_;
+            size_t index_;
+        };
+
+        size_t size() const { return sequence_.size(); }
+        iterator begin() { return iterator(&sequence_, 0); }
+        void push_back(int data) { sequence_.insertLast().data_ = data; }
+
+        iterator insert(iterator position, int data)
+        {
+            sequence_.insert(position.getIndex()).data_ = data;
+            return position;
+        }
+
+        iterator erase(iterator position)
+        {
+            sequence_.remove(position.getIndex());
+            return position;
+        }
+
+    private:
+        Sequence sequence_;
+    };
+
     /**
      * @brief Container for all list analyzers.
      */
@@ -71,6 +158,22 @@ namespace ds::utils
             this->addAnalyzer(std::make_unique<ListInsertAnalyzer<std::list<int>>>("list-insert"));
             this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<std::vector<int>>>("vector-remove"));
             this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<std::list<int>>>("list-remove"));
+            this->addAnalyzer(std::make_unique<ListInsertAnalyzer<SequenceListAdapter<amt::IS<int>>>>("implicit-insert"));
+            this->addAnalyzer(std::make_unique<ListInsertAnalyzer<SequenceListAdapter<amt::GIS<int>>>>("gap-insert"));
+            this->addAnalyzer(std::make_unique<ListCursorInsertAnalyzer<SequenceListAdapter<amt::IS<int>>>>("implicit-cursor-insert"));
+            this->addAnalyzer(std::make_unique<ListCursorInsertAnalyzer<SequenceListAdapter<amt::GIS<int>>>>("gap-cursor-insert"));
+            this->addAnalyzer(std::make_unique<ListCursorInsertAnalyzer<std::vector<int>>>("vector-cursor-insert"));
+            this->addAnalyzer(std::make_unique<ListCursorInsertAnalyzer<SequenceListAdapter<amt::DoublyLS<int>>>>("dls-cursor-insert"));
+            this->addAnalyzer(std::make_unique<ListCursorInsertAnalyzer<SequenceListAdapter<amt::UnrolledLS<int>>>>("unrolled-cursor-insert"));
+            this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<SequenceListAdapter<amt::IS<int>>>>("implicit-remove"));
+            this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<SequenceListAdapter<amt::DoublyLS<int>>>>("dls-remove"));
+            this->addAnalyzer(std::make_unique<ListCursorInsertAnalyzer<SequenceListAdapter<amt::SkipLS<int>>>>("skip-list-cursor-insert"));
+            this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<SequenceListAdapter<amt::UnrolledLS<int>>>>("unrolled-remove"));
+            this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<SequenceListAdapter<amt::SkipLS<int>>>>("skip-list-remove"));
+            this->addAnalyzer(std::make_unique<ListIndexLoopAnalyzer<std::vector<int>>>("vector-index-loop"));
+            this->addAnalyzer(std::make_unique<ListIndexLoopAnalyzer<std::list<int>>>("list-index-loop"));
+            this->addAnalyzer(std::make_unique<ListIndexLoopAnalyzer<SequenceListAdapter<amt::SinglyLS<int>>>>("sls-index-loop"));
+            this->addAnalyzer(std::make_unique<ListIndexLoopAnalyzer<SequenceListAdapter<amt::DoublyLS<int>>>>("dls-index-loop"));
         }
     };
 
@@ -138,4 +241,39 @@ namespace ds::utils
         auto rmPosition = std::next(structure.begin(), this->getRandomIndex());
         structure.erase(rmPosition);
     }
+
+    template <class List>
+    ListCursorInsertAnalyzer<List>::ListCursorInsertAnalyzer(const std::string& name) :
+        ListAnalyzer<List>(name)
+    {
+    }
+
+    template <class List>
+    void ListCursorInsertAnalyzer<List>::executeOperation(List& structure)
+    {
+        auto position = std::next(structure.begin(), this->getRandomIndex());
+        for (size_t i = 0; i < BURST_SIZE; ++i)
+        {
+            position = structure.insert(position, this->getRandomData());
+            ++position;
+        }
+    }
+
+    template <class List>
+    ListIndexLoopAnalyzer<List>::ListIndexLoopAnalyzer(const std::string& name) :
+        ListAnalyzer<List>(name),
+        result_(0)
+    {
+    }
+
+    template <class List>
+    void ListIndexLoopAnalyzer<List>::executeOperation(List& structure)
+    {
+        long long sum = 0;
+        for (size_t i = 0; i < structure.size(); ++i)
+        {
+            sum += *std::next(structure.begin(), i);
+        }
+        result_ = sum;
+    }
 }
@@ -0,0 +1,347 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_sequence.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/mm/pool_memory_manager.h>
+#include <libds/mm/monotonic_arena_memory_manager.h>
+#include <libds/mm/thread_caching_memory_manager.h>
+#include <libds/mm/virtual_memory_region.h>
+#include <random>
+#include <thread>
+
+namespace ds::utils
+{
+    /**
+     * @brief Explicit sequence using memory manager of type @p Manager.
+     */
+    template<class Sequence, class Manager>
+    class ManagedSequence : public Sequence
+    {
+    public:
+        ManagedSequence() :
+            Sequence(new Manager())
+        {
+        }
+
+        ManagedSequence(const ManagedSequence& other) :
+            ManagedSequence()
+        {
+            this->assign(other);
+        }
+    };
+
+    /**
+     * @brief Implicit sequence whose memory is a reserved virtual memory region.
+     */
+    template<typename DataType>
+    class VirtualMemorySequence : public amt::ImplicitSequence<DataType>
+    {
+    public:
+        using MemoryManagerType = typename amt::ImplicitSequence<DataType>::MemoryManagerType;
+
+        VirtualMemorySequence() :
+            amt::ImplicitSequence<DataType>(new MemoryManagerType(
+                0,
+                new mm::HugePageGrowthPolicy(),
+                new mm::VirtualMemoryRegion(RESERVED_SIZE, true)))
+        {
+        }
+
+        static const size_t RESERVED_SIZE = 256 * 1024 * 1024;
+    };
+
+    /**
+     * @brief Common base for analyzers of memory managers used by sequences.
+     */
+    template<class Sequence>
+    class SequenceAnalyzer : public ComplexityAnalyzer<Sequence>
+    {
+    protected:
+        explicit SequenceAnalyzer(const std::string& name);
+
+    protected:
+        void beforeOperation(Sequence& structure) override;
+        size_t getRandomIndex() const;
+        int getRandomData() const;
+
+    private:
+        void insertNElements(Sequence& sequence, size_t n);
+
+    private:
+        std::default_random_engine rngData_;
+        std::default_random_engine rngIndex_;
+        size_t index_;
+        int data_;
+    };
+
+    /**
+     * @brief Analyzes the allocation of a block at the beginning of a sequence.
+     */
+    template<class Sequence>
+    class SequenceInsertAnalyzer : public SequenceAnalyzer<Sequence>
+    {
+    public:
+        explicit SequenceInsertAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes the allocation of a block at the end of a sequence.
+     */
+    template<class Sequence>
+    class SequenceInsertLastAnalyzer : public SequenceAnalyzer<Sequence>
+    {
+    public:
+        explicit SequenceInsertLastAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes the release of a block at the beginning of a sequence.
+     */
+    template<class Sequence>
+    class SequenceRemoveAnalyzer : public SequenceAnalyzer<Sequence>
+    {
+    public:
+        explicit SequenceRemoveAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes the access to a block at a random index.
+     */
+    template<class Sequence>
+    class SequenceAccessAnalyzer : public SequenceAnalyzer<Sequence>
+    {
+    public:
+        explicit SequenceAccessAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes push and pop of blocks in sequences owned by concurrently
+     * running threads. Steps correspond to the number of threads, each thread
+     * pushes and pops step size blocks.
+     */
+    template<class Sequence>
+    class ConcurrentPushPopAnalyzer : public LeafAnalyzer
+    {
+    public:
+        explicit ConcurrentPushPopAnalyzer(const std::string& name);
+        void analyze() override;
+
+    private:
+        using duration_t = std::chrono::nanoseconds;
+
+    private:
+        void pushPop() const;
+        void saveToCsvFile(const std::map<size_t, std::vector<duration_t>>& data) const;
+    };
+
+    /**
+     * @brief Container for all memory manager analyzers.
+     */
+    class MemoryManagersAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        MemoryManagersAnalyzer() :
+            CompositeAnalyzer("MemoryManagers")
+        {
+            using HeapDLS = amt::DoublyLS<int>;
+            using PoolDLS = ManagedSequence<amt::DoublyLS<int>, mm::PoolMemoryManager<amt::DLSBlock<int>>>;
+            using ArenaDLS = ManagedSequence<amt::DoublyLS<int>, mm::MonotonicArenaMemoryManager<amt::DLSBlock<int>>>;
+            using HeapIS = amt::IS<int>;
+            using VirtualIS = VirtualMemorySequence<int>;
+            using ThreadCachingDLS = ManagedSequence<amt::DoublyLS<int>, mm::ThreadCachingMemoryManager<amt::DLSBlock<int>>>;
+
+            this->addAnalyzer(std::make_unique<SequenceInsertAnalyzer<HeapDLS>>("dls-heap-insert"));
+            this->addAnalyzer(std::make_unique<SequenceInsertAnalyzer<PoolDLS>>("dls-pool-insert"));
+            this->addAnalyzer(std::make_unique<SequenceInsertAnalyzer<ArenaDLS>>("dls-arena-insert"));
+            this->addAnalyzer(std::make_unique<SequenceRemoveAnalyzer<HeapDLS>>("dls-heap-remove"));
+            this->addAnalyzer(std::make_unique<SequenceRemoveAnalyzer<PoolDLS>>("dls-pool-remove"));
+            this->addAnalyzer(std::make_unique<SequenceInsertLastAnalyzer<HeapIS>>("is-heap-insert-last"));
+            this->addAnalyzer(std::make_unique<SequenceInsertLastAnalyzer<VirtualIS>>("is-virtual-insert-last"));
+            this->addAnalyzer(std::make_unique<SequenceAccessAnalyzer<HeapIS>>("is-heap-access"));
+            this->addAnalyzer(std::make_unique<SequenceAccessAnalyzer<VirtualIS>>("is-virtual-access"));
+            this->addAnalyzer(std::make_unique<ConcurrentPushPopAnalyzer<HeapDLS>>("dls-heap-threads"));
+            this->addAnalyzer(std::make_unique<ConcurrentPushPopAnalyzer<PoolDLS>>("dls-pool-threads"));
+            this->addAnalyzer(std::make_unique<ConcurrentPushPopAnalyzer<ThreadCachingDLS>>("dls-thread-caching-threads"));
+        }
+    };
+
+    template<class Sequence>
+    SequenceAnalyzer<Sequence>::SequenceAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Sequence>(name, [this](Sequence& sequence, size_t n) { this->insertNElements(sequence, n); }),
+        rngData_(std::random_device()()),
+        rngIndex_(std::random_device()()),
+        index_(0),
+        data_(0)
+    {
+    }
+
+    template<class Sequence>
+    void SequenceAnalyzer<Sequence>::beforeOperation(Sequence& structure)
+    {
+        std::uniform_int_distribution<size_t> indexDist(0, structure.size() - 1);
+        index_ = indexDist(rngIndex_);
+        data_ = rngData_();
+    }
+
+    template<class Sequence>
+    size_t SequenceAnalyzer<Sequence>::getRandomIndex() const
+    {
+        return index_;
+    }
+
+    template<class Sequence>
+    int SequenceAnalyzer<Sequence>::getRandomData() const
+    {
+        return data_;
+    }
+
+    template<class Sequence>
+    void SequenceAnalyzer<Sequence>::insertNElements(Sequence& sequence, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            sequence.insertLast().data_ = rngData_();
+        }
+    }
+
+    template<class Sequence>
+    SequenceInsertAnalyzer<Sequence>::SequenceInsertAnalyzer(const std::string& name) :
+        SequenceAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void SequenceInsertAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        structure.insertFirst().data_ = this->getRandomData();
+    }
+
+    template<class Sequence>
+    SequenceInsertLastAnalyzer<Sequence>::SequenceInsertLastAnalyzer(const std::string& name) :
+        SequenceAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void SequenceInsertLastAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        structure.insertLast().data_ = this->getRandomData();
+    }
+
+    template<class Sequence>
+    SequenceRemoveAnalyzer<Sequence>::SequenceRemoveAnalyzer(const std::string& name) :
+        SequenceAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void SequenceRemoveAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        structure.removeFirst();
+    }
+
+    template<class Sequence>
+    SequenceAccessAnalyzer<Sequence>::SequenceAccessAnalyzer(const std::string& name) :
+        SequenceAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void SequenceAccessAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        structure.access(this->getRandomIndex())->data_ = this->getRandomData();
+    }
+
+    template<class Sequence>
+    ConcurrentPushPopAnalyzer<Sequence>::ConcurrentPushPopAnalyzer(const std::string& name) :
+        LeafAnalyzer(name)
+    {
+    }
+
+    template<class Sequence>
+    void ConcurrentPushPopAnalyzer<Sequence>::analyze()
+    {
+        this->resetSuccess();
+        std::map<size_t, std::vector<duration_t>> samples;
+
+        for (size_t replication = 0; replication < this->getReplicationCount(); ++replication)
+        {
+            for (size_t threadCount = 1; threadCount <= this->getStepCount(); ++threadCount)
+            {
+                std::vector<std::thread> threads;
+                auto time_start = std::chrono::high_resolution_clock::now();
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    threads.emplace_back([this]() { this->pushPop(); });
+                }
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+                auto time_end = std::chrono::high_resolution_clock::now();
+
+                samples[threadCount].push_back(time_end - time_start);
+            }
+        }
+
+        this->saveToCsvFile(samples);
+        this->setSuccess();
+    }
+
+    template<class Sequence>
+    void ConcurrentPushPopAnalyzer<Sequence>::pushPop() const
+    {
+        Sequence sequence;
+        const size_t n = this->getStepSize();
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            sequence.insertLast().data_ = static_cast<int>(i);
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            sequence.removeFirst();
+        }
+    }
+
+    template<class Sequence>
+    void ConcurrentPushPopAnalyzer<Sequence>::saveToCsvFile(const std::map<size_t, std::vector<duration_t>>& data) const
+    {
+        constexpr char Separator = ';';
+        std::ofstream ost(this->getOutputPath());
+
+        if (!ost.is_open())
+        {
+            throw std::runtime_error("Failed to open output file.");
+        }
+
+        const size_t rowCount = data.begin()->second.size();
+        const size_t lastSize = (--data.end())->first;
+
+        for (const auto& [size, durations] : data)
+        {
+            ost << size << (size != lastSize ? Separator : '\n');
+        }
+
+        for (size_t i = 0; i < rowCount; ++i)
+        {
+            for (const auto& [size, durations] : data)
+            {
+                ost << durations[i].count() << (size != lastSize ? Separator : '\n');
+            }
+        }
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/table.h>
+#include <random>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes lookups in a table with even keys 0, 2, 4, ... inserted in order.
+     * Every operation searches LOOKUP_COUNT random keys, about half of them are present.
+     */
+    template<class Table>
+    class TableLookupAnalyzer : public ComplexityAnalyzer<Table>
+    {
+    public:
+        explicit TableLookupAnalyzer(const std::string& name);
+
+    protected:
+        void beforeOperation(Table& structure) override;
+        void executeOperation(Table& structure) override;
+
+        virtual void insertNItems(Table& table, size_t n);
+
+    private:
+        static constexpr size_t LOOKUP_COUNT = 1000;
+
+    private:
+        std::default_random_engine rngKey_;
+        std::vector<int> keys_;
+        size_t found_;
+    };
+
+    /**
+     * @brief Analyzes lookups in an Eytzinger table, which is rebuilt with every new item.
+     */
+    class EytzingerTableLookupAnalyzer : public TableLookupAnalyzer<adt::EytzingerTable<int, int>>
+    {
+    public:
+        explicit EytzingerTableLookupAnalyzer(const std::string& name);
+
+    protected:
+        void insertNItems(adt::EytzingerTable<int, int>& table, size_t n) override;
+    };
+
+    /**
+     * @brief Container for all analyzers of table lookups.
+     */
+    class TableLookupsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        TableLookupsAnalyzer() :
+            CompositeAnalyzer("TableLookups")
+        {
+            this->addAnalyzer(std::make_unique<TableLookupAnalyzer<adt::SortedSequenceTable<int, int>>>("sorted-sequence-table-lookup"));
+            this->addAnalyzer(std::make_unique<EytzingerTableLookupAnalyzer>("eytzinger-table-lookup"));
+        }
+    };
+
+    template<class Table>
+    TableLookupAnalyzer<Table>::TableLookupAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Table>(name, [this](Table& table, size_t n) { this->insertNItems(table, n); }),
+        rngKey_(std::random_device()()),
+        found_(0)
+    {
+    }
+
+    template<class Table>
+    void TableLookupAnalyzer<Table>::beforeOperation(Table& structure)
+    {
+        std::uniform_int_distribution<int> distribution(0, static_cast<int>(2 * structure.size()));
+        keys_.resize(LOOKUP_COUNT);
+        for (int& key : keys_)
+        {
+            key = distribution(rngKey_);
+        }
+    }
+
+    template<class Table>
+    void TableLookupAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        for (int key : keys_)
+        {
+            int* data = nullptr;
+            if (structure.tryFind(key, data))
+            {
+                ++found_;
+            }
+        }
+    }
+
+    template<class Table>
+    void TableLookupAnalyzer<Table>::insertNItems(Table& table, size_t n)
+    {
+        const int first = static_cast<int>(table.size());
+        for (int i = first; i < first + static_cast<int>(n); ++i)
+        {
+            table.insert(2 * i, i);
+        }
+    }
+
+    inline EytzingerTableLookupAnalyzer::EytzingerTableLookupAnalyzer(const std::string& name) :
+        TableLookupAnalyzer<adt::EytzingerTable<int, int>>(name)
+    {
+    }
+
+    inline void EytzingerTableLookupAnalyzer::insertNItems(adt::EytzingerTable<int, int>& table, size_t n)
+    {
+        std::vector<adt::TabItem<int, int>> items(table.size() + n);
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            items[i].key_ = static_cast<int>(2 * i);
+            items[i].data_ = static_cast<int>(i);
+        }
+        table.assign(adt::EytzingerTable<int, int>(items.begin(), items.end()));
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
+#include <libds/amt/chunked_implicit_sequence.h>
 
 namespace ds::adt {
 
@@ -23,17 +24,21 @@ namespace ds::adt {
 
 	//----------
 
-	template <typename T>
+	/**
+	 * @brief Array stored in an implicit sequence of type @p SequenceType.
+	 * With amt::ChunkedIS the elements are kept in fixed-size chunks instead of one block of memory.
+	 */
+	template <typename T, typename SequenceType = amt::IS<T>>
 	class Array :
 		public ADS<T>
 	{
 	public:
-		using IteratorType = typename amt::IS<T>::IteratorType;
+		using IteratorType = typename SequenceType::IteratorType;
 
 	public:
 		Array(size_t size);
 		Array(Dimension dimension);
-		Array(const Array<T>& other);
+		Array(const Array& other);
 
 		ADT& assign(const ADT& other) override;
 		void clear() override;
@@ -51,12 +56,15 @@ namespace ds::adt {
 	private:
 		bool validateIndex(long long index) const;
 		size_t mapIndex(long long index) const;
-		amt::IS<T>* getSequence() const;
+		SequenceType* getSequence() const;
 
 	private:
 		long long base_;
 	};
 
+	template <typename T>
+	using ChunkedArray = Array<T, amt::ChunkedIS<T>>;
+
 	//----------
 
 	template <typename T>
@@ -131,121 +139,118 @@ namespace ds::adt {
 
 	//----------
 
-	template<typename T>
-	Array<T>::Array(size_t size) :
+	template<typename T, typename SequenceType>
+	Array<T, SequenceType>::Array(size_t size) :
 		Array(Dimension(0, size))
 	{
 	}
 
-	template<typename T>
-	Array<T>::Array(Dimension dimension) :
-		ADS<T>(new amt::IS<T>(dimension.getSize(), true)),
+	template<typename T, typename SequenceType>
+	Array<T, SequenceType>::Array(Dimension dimension) :
+		ADS<T>(new SequenceType(dimension.getSize(), true)),
 		base_(dimension.getBase())
 	{
 	}
 
-	template<typename T>
-	Array<T>::Array(const Array<T>& other) :
-		ADS<T>(new amt::IS<T>(), other),
+	template<typename T, typename SequenceType>
+	Array<T, SequenceType>::Array(const Array& other) :
+		ADS<T>(new SequenceType(), other),
 		base_(other.base_)
 	{
 	}
 
-	template<typename T>
-	ADT& Array<T>::assign(const ADT& other)
+	template<typename T, typename SequenceType>
+	ADT& Array<T, SequenceType>::assign(const ADT& other)
 	{
-		auto otherArray = dynamic_cast<Array<T>*>(&other);
-		if (otherArray == nullptr) {
-			throw std::exception("not array ");
+		const Array<T, SequenceType>& otherArray = dynamic_cast<const Array<T, SequenceType>&>(other);
+		if (size() != otherArray.size()) {
+			this->error("Array sizes are different!");
 		}
-		if (size() != other.size()) {
-			throw std::exception("diffenert size");
-		}
-		getSequence()->assign(otherArray->getSequence());
+		ADS<T>::assign(otherArray);
 		return *this;
 	}
 
-	template<typename T>
-	void Array<T>::clear()
+	template<typename T, typename SequenceType>
+	void Array<T, SequenceType>::clear()
 	{
 		this->error("Array can't be cleared!");
 	}
 
-	template<typename T>
-	bool Array<T>::equals(const ADT& other)
+	template<typename T, typename SequenceType>
+	bool Array<T, SequenceType>::equals(const ADT& other)
 	{
-		const Array<T>* otherArray = dynamic_cast<const Array<T>*>(&other);
+		const Array<T, SequenceType>* otherArray = dynamic_cast<const Array<T, SequenceType>*>(&other);
 		return otherArray != nullptr &&
 			base_ == otherArray->base_ &&
 			ADS<T>::equals(other);
 	}
 
-	template<typename T>
-	bool Array<T>::isEmpty() const
+	template<typename T, typename SequenceType>
+	bool Array<T, SequenceType>::isEmpty() const
 	{
 		return false;
 	}
 
-	template<typename T>
-	size_t Array<T>::size() const
+	template<typename T, typename SequenceType>
+	size_t Array<T, SequenceType>::size() const
 	{
 		return this->getSequence()->size();
 	}
 
-	template<typename T>
-	long long Array<T>::getBase() const
+	template<typename T, typename SequenceType>
+	long long Array<T, SequenceType>::getBase() const
 	{
 		return base_;
 	}
 
-	template<typename T>
-	T Array<T>::access(long long index) const
+	template<typename T, typename SequenceType>
+	T Array<T, SequenceType>::access(long long index) const
 	{
 		// TODO 07
 		// po implementacii vymazte vyhodenie vynimky!
 		throw std::runtime_error("Not implemented yet");
 	}
 
-	template<typename T>
-	void Array<T>::set(T element, long long index)
+	template<typename T, typename SequenceType>
+	void Array<T, SequenceType>::set(T element, long long index)
 	{
 		// TODO 07
 		// po implementacii vymazte vyhodenie vynimky!
 		throw std::runtime_error("Not implemented yet");
 	}
 
-	template <typename T>
-	auto Array<T>::begin() -> IteratorType
+	template<typename T, typename SequenceType>
+	auto Array<T, SequenceType>::begin() -> IteratorType
 	{
 		// TODO 07
 		// po implementacii vymazte vyhodenie vynimky!
 		throw std::runtime_error("Not implemented yet");
 	}
 
-	template <typename T>
-	auto Array<T>::end() -> IteratorType
+	template<typename T, typename SequenceType>
+	auto Array<T, SequenceType>::end() -> IteratorType
 	{
 		// TODO 07
 		// po implementacii vymazte vyhodenie vynimky!
 		throw std::runtime_error("Not implemented yet");
 	}
 
-	template<typename T>
-	amt::IS<T>* Array<T>::getSequence() const
+	template<typename T, typename SequenceType>
+	SequenceType* Array<T, SequenceType>::getSequence() const
 	{
-		return dynamic_cast<amt::IS<T>*>(this->memoryStructure_);
+		return dynamic_cast<SequenceType*>(this->memoryStructure_);
 	}
 
-	template<typename T>
-	bool Array<T>::validateIndex(long long index) const
+	template<typename T, typename SequenceType>
+	bool Array<T, SequenceType>::validateIndex(long long index) const
 	{
 		// TODO 07
 		// po implementacii vymazte vyhodenie vynimky!
 		throw std::runtime_error("Not implemented yet");
 	}
 
-	template<typename T>
-	size_t Array<T>::mapIndex(long long index) const
+	template<typename T, typename SequenceType>
+	size_t Array<T, SequenceType>::mapIndex(long long index) const
 	{
 		// TODO 07
 		// po implementacii vymazte vyhodenie vynimky!
@@ -3,6 +3,9 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
+#include <libds/amt/unrolled_linked_sequence.h>
+#include <libds/amt/skip_list_sequence.h>
+#include <libds/amt/rope_sequence.h>
 
 namespace ds::adt {
 
@@ -28,6 +31,9 @@ namespace ds::adt {
         virtual void removeFirst() = 0;
         virtual void removeLast() = 0;
         virtual void remove(size_t index) = 0;
+
+        virtual void appendN(size_t count, T element) = 0;
+        virtual void removeRange(size_t index, size_t count) = 0;
     };
 
     //----------
@@ -62,11 +68,19 @@ namespace ds::adt {
         void removeLast() override;
         void remove(size_t index) override;
 
+        void appendN(size_t count, T element) override;
+        void removeRange(size_t index, size_t count) override;
+        template<typename Iterator>
+        void insertRange(size_t index, Iterator first, Iterator last);
+
         IteratorType begin();
         IteratorType end();
 
     protected:
-        SequenceType* getSequence() const;
+        const amt::StaticSequence<SequenceType>* getSequence() const;
+
+    private:
+        amt::StaticSequence<SequenceType> sequence_;
     };
 
     //----------
@@ -87,6 +101,14 @@ namespace ds::adt {
 
     //----------
 
+    template <typename T>
+    class ImplicitGapList :
+        public GeneralList<T, amt::GIS<T>>
+    {
+    };
+
+    //----------
+
     template <typename T>
     class SinglyLinkedList :
         public GeneralList<T, amt::SinglyLS<T>>
@@ -119,15 +141,47 @@ namespace ds::adt {
 
     //----------
 
+    template <typename T, size_t N = 32>
+    class UnrolledLinkedList :
+        public GeneralList<T, amt::UnrolledLS<T, N>>
+    {
+    };
+
+    //----------
+
+    template <typename T>
+    class SkipList :
+        public GeneralList<T, amt::SkipLS<T>>
+    {
+    };
+
+    //----------
+
+    template <typename T, size_t N = 64>
+    class RopeList :
+        public GeneralList<T, amt::RopeS<T, N>>
+    {
+    public:
+        using GeneralList<T, amt::RopeS<T, N>>::insertRange;
+
+        void concat(RopeList& other);
+        void splitAt(size_t index, RopeList& other);
+        void insertRange(size_t index, RopeList& other);
+    };
+
+    //----------
+
     template<typename T, typename SequenceType>
     GeneralList<T, SequenceType>::GeneralList() :
-        ADS<T>(new SequenceType())
+        ADS<T>(new SequenceType()),
+        sequence_(dynamic_cast<SequenceType*>(this->memoryStructure_))
     {
     }
 
     template<typename T, typename SequenceType>
     GeneralList<T, SequenceType>::GeneralList(const GeneralList& other) :
-        ADS<T>(new SequenceType(), other)
+        ADS<T>(new SequenceType(), other),
+        sequence_(dynamic_cast<SequenceType*>(this->memoryStructure_))
     {
     }
 
@@ -253,6 +307,35 @@ namespace ds::adt {
         getSequence()->remove(index);
     }
 
+    template<typename T, typename SequenceType>
+    void GeneralList<T, SequenceType>::appendN(size_t count, T element)
+    {
+        auto block = this->getSequence()->appendN(count);
+        for (size_t i = 0; i < count; ++i) {
+            block->data_ = element;
+            block = this->getSequence()->accessNext(*block);
+        }
+    }
+
+    template<typename T, typename SequenceType>
+    void GeneralList<T, SequenceType>::removeRange(size_t index, size_t count)
+    {
+        if (index > this->size() || count > this->size() - index) {
+            throw std::out_of_range("invalid index");
+        }
+        this->getSequence()->removeRange(index, count);
+    }
+
+    template<typename T, typename SequenceType>
+    template<typename Iterator>
+    void GeneralList<T, SequenceType>::insertRange(size_t index, Iterator first, Iterator last)
+    {
+        if (index > this->size()) {
+            throw std::out_of_range("invalid index");
+        }
+        this->getSequence()->insertRange(index, first, last);
+    }
+
     template <typename T, typename SequenceType>
     auto GeneralList<T, SequenceType>::begin() -> IteratorType
     {
@@ -266,8 +349,32 @@ namespace ds::adt {
     }
 
     template<typename T, typename SequenceType>
-    SequenceType* GeneralList<T, SequenceType>::getSequence() const
+    auto GeneralList<T, SequenceType>::getSequence() const -> const amt::StaticSequence<SequenceType>*
+    {
+        return &sequence_;
+    }
+
+    template<typename T, size_t N>
+    void RopeList<T, N>::concat(RopeList& other)
+    {
+        this->getSequence()->get()->concat(*other.getSequence()->get());
+    }
+
+    template<typename T, size_t N>
+    void RopeList<T, N>::splitAt(size_t index, RopeList& other)
     {
-        return dynamic_cast<SequenceType*>(this->memoryStructure_);
+        if (index > this->size()) {
+            throw std::out_of_range("invalid index");
+        }
+        this->getSequence()->get()->splitAt(index, *other.getSequence()->get());
+    }
+
+    template<typename T, size_t N>
+    void RopeList<T, N>::insertRange(size_t index, RopeList& other)
+    {
+        if (index > this->size()) {
+            throw std::out_of_range("invalid index");
+        }
+        this->getSequence()->get()->insertRange(index, *other.getSequence()->get());
     }
 }
\ No newline at end of file
@@ -2,7 +2,10 @@
 
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
+#include <libds/amt/chunked_implicit_sequence.h>
+#include <libds/amt/ring_implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
+#include <type_traits>
 
 namespace ds::adt {
 
@@ -18,7 +21,12 @@ namespace ds::adt {
 
     //----------
 
-    template<typename T>
+    /**
+     * @brief Queue stored in an implicit sequence of type @p SequenceType.
+     * The default cyclic sequence has a fixed capacity. With amt::ChunkedIS the queue
+     * is unbounded, growth does not copy the elements and references returned by peek stay valid.
+     */
+    template<typename T, typename SequenceType = amt::CIS<T>>
     class ImplicitQueue :
         public Queue<T>,
         public ADS<T>
@@ -41,7 +49,10 @@ namespace ds::adt {
         static const int INIT_CAPACITY = 100;
 
     private:
-        amt::CIS<T>* getSequence() const;
+        static constexpr bool IS_CYCLIC = std::is_base_of_v<amt::CIS<T>, SequenceType>;
+
+        SequenceType* getSequence() const;
+        T& elementAt(size_t index) const;
 
     private:
         size_t insertionIndex_;
@@ -49,6 +60,58 @@ namespace ds::adt {
         size_t size_;
     };
 
+    template<typename T>
+    using ChunkedQueue = ImplicitQueue<T, amt::ChunkedIS<T>>;
+
+    template<typename T>
+    using RingQueue = ImplicitQueue<T, amt::RingIS<T>>;
+
+    //----------
+
+    template <typename T>
+    class Deque :
+        public Queue<T>
+    {
+    public:
+        virtual void pushFront(T element) = 0;
+        virtual void pushBack(T element) = 0;
+        virtual T& peekFront() = 0;
+        virtual T& peekBack() = 0;
+        virtual T popFront() = 0;
+        virtual T popBack() = 0;
+    };
+
+    //----------
+
+    /**
+     * @brief Double-ended queue stored in a ring buffer. Elements are pushed and popped
+     * at both ends in O(1) and the capacity grows as needed. As a queue it pushes back and pops front.
+     */
+    template<typename T>
+    class ImplicitDeque :
+        public Deque<T>,
+        public ADS<T>
+    {
+    public:
+        ImplicitDeque();
+        ImplicitDeque(const ImplicitDeque& other);
+        ImplicitDeque(size_t capacity);
+
+        void pushFront(T element) override;
+        void pushBack(T element) override;
+        T& peekFront() override;
+        T& peekBack() override;
+        T popFront() override;
+        T popBack() override;
+
+        void push(T element) override;
+        T& peek() override;
+        T pop() override;
+
+    private:
+        amt::RingIS<T>* getSequence() const;
+    };
+
     //----------
 
     template<typename T>
@@ -69,108 +132,236 @@ namespace ds::adt {
 
     //----------
 
-    template<typename T>
-    ImplicitQueue<T>::ImplicitQueue():
+    template<typename T, typename SequenceType>
+    ImplicitQueue<T, SequenceType>::ImplicitQueue():
         ImplicitQueue(INIT_CAPACITY)
     {
     }
 
-    template<typename T>
-    ImplicitQueue<T>::ImplicitQueue(size_t capacity) :
-        ADS<T>(new amt::CIS<T>(capacity, true)),
+    template<typename T, typename SequenceType>
+    ImplicitQueue<T, SequenceType>::ImplicitQueue(size_t capacity) :
+        ADS<T>(IS_CYCLIC ? new SequenceType(capacity, true) : new SequenceType()),
         insertionIndex_(0),
         removalIndex_(0),
         size_(0)
     {
     }
 
-    template<typename T>
-    ImplicitQueue<T>::ImplicitQueue(const ImplicitQueue& other) :
-        ADS<T>(new amt::CIS<T>(), other),
+    template<typename T, typename SequenceType>
+    ImplicitQueue<T, SequenceType>::ImplicitQueue(const ImplicitQueue& other) :
+        ADS<T>(new SequenceType(), other),
         insertionIndex_(other.insertionIndex_),
         removalIndex_(other.removalIndex_),
         size_(other.size_)
     {
     }
 
-    template<typename T>
-    ADT& ImplicitQueue<T>::assign(const ADT& other)
+    template<typename T, typename SequenceType>
+    ADT& ImplicitQueue<T, SequenceType>::assign(const ADT& other)
     {
         // TODO 09
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
 
-    template<typename T>
-    void ImplicitQueue<T>::clear()
+    template<typename T, typename SequenceType>
+    void ImplicitQueue<T, SequenceType>::clear()
     {
-        insertionIndex_ = removalIndex_;
+        if constexpr (IS_CYCLIC)
+        {
+            insertionIndex_ = removalIndex_;
+        }
+        else
+        {
+            this->getSequence()->clear();
+        }
         size_ = 0;
     }
 
-    template<typename T>
-    size_t ImplicitQueue<T>::size() const
+    template<typename T, typename SequenceType>
+    size_t ImplicitQueue<T, SequenceType>::size() const
     {
         return size_;
     }
 
-    template<typename T>
-    bool ImplicitQueue<T>::isEmpty() const
+    template<typename T, typename SequenceType>
+    bool ImplicitQueue<T, SequenceType>::isEmpty() const
     {
         return this->size() == 0;
     }
 
-    template<typename T>
-    bool ImplicitQueue<T>::equals(const ADT& other)
+    template<typename T, typename SequenceType>
+    bool ImplicitQueue<T, SequenceType>::equals(const ADT& other)
     {
-        const ImplicitQueue<T>* otherQueue = dynamic_cast<const ImplicitQueue<T>*>(&other);
-        if (this == &otherQueue) {
+        const ImplicitQueue<T, SequenceType>* otherQueue = dynamic_cast<const ImplicitQueue<T, SequenceType>*>(&other);
+        if (otherQueue == nullptr) {
+            return false;
+        }
+        if (this == otherQueue) {
             return true;
         }
         if (size() != otherQueue->size()) {
             return false;
         }
-        if (otherQueue == nullptr) {
-            
+        for (size_t i = 0; i < size_; ++i) {
+            if (!(this->elementAt(i) == otherQueue->elementAt(i))) {
+                return false;
+            }
         }
+        return true;
     }
 
-    template<typename T>
-    void ImplicitQueue<T>::push(T element)
+    template<typename T, typename SequenceType>
+    void ImplicitQueue<T, SequenceType>::push(T element)
     {
-        if (size() = this->getSequence()->size()) {
-            this->error("queue capacity is full");
+        if constexpr (IS_CYCLIC)
+        {
+            if (size() == this->getSequence()->size()) {
+                this->error("queue capacity is full");
+            }
+            this->getSequence()->access(insertionIndex_)->data_ = element;
+            insertionIndex_ = this->getSequence()->indexOfNext(insertionIndex_);
+        }
+        else
+        {
+            this->getSequence()->insertLast().data_ = element;
         }
-        this->getSequence()->access(insertionIndex_)->data_ = element;
-        insertionIndex_ = this->getSequence()->indexOfNext(insertionIndex_);
         size_++;
     }
 
-    template<typename T>
-    T& ImplicitQueue<T>::peek()
+    template<typename T, typename SequenceType>
+    T& ImplicitQueue<T, SequenceType>::peek()
     {
         if (isEmpty()) {
             this->error("queue is empty");
         }
-        return this->getSequence()->access(insertionIndex_)->data_;
+        return this->elementAt(0);
     }
 
-    template<typename T>
-    T ImplicitQueue<T>::pop()
+    template<typename T, typename SequenceType>
+    T ImplicitQueue<T, SequenceType>::pop()
     {
         if (isEmpty()) {
             this->error("queue is empty");
         }
-        auto result = getSequence()->access(insertionIndex_)->data_;
-        insertionIndex_ = getSequence()->indexOfNext(insertionIndex_);
+        auto result = this->elementAt(0);
+        if constexpr (IS_CYCLIC)
+        {
+            removalIndex_ = getSequence()->indexOfNext(removalIndex_);
+        }
+        else
+        {
+            getSequence()->removeFirst();
+        }
         --size_;
         return result;
     }
 
+    template<typename T, typename SequenceType>
+    SequenceType* ImplicitQueue<T, SequenceType>::getSequence() const
+    {
+        return dynamic_cast<SequenceType*>(this->memoryStructure_);
+    }
+
+    template<typename T, typename SequenceType>
+    T& ImplicitQueue<T, SequenceType>::elementAt(size_t index) const
+    {
+        if constexpr (IS_CYCLIC)
+        {
+            return this->getSequence()->access((removalIndex_ + index) % this->getSequence()->size())->data_;
+        }
+        else
+        {
+            return this->getSequence()->access(index)->data_;
+        }
+    }
+
+    template<typename T>
+    ImplicitDeque<T>::ImplicitDeque() :
+        ADS<T>(new amt::RingIS<T>())
+    {
+    }
+
+    template<typename T>
+    ImplicitDeque<T>::ImplicitDeque(const ImplicitDeque& other) :
+        ADS<T>(new amt::RingIS<T>(), other)
+    {
+    }
+
+    template<typename T>
+    ImplicitDeque<T>::ImplicitDeque(size_t capacity) :
+        ADS<T>(new amt::RingIS<T>(capacity, false))
+    {
+    }
+
+    template<typename T>
+    void ImplicitDeque<T>::pushFront(T element)
+    {
+        this->getSequence()->insertFirst().data_ = element;
+    }
+
+    template<typename T>
+    void ImplicitDeque<T>::pushBack(T element)
+    {
+        this->getSequence()->insertLast().data_ = element;
+    }
+
+    template<typename T>
+    T& ImplicitDeque<T>::peekFront()
+    {
+        if (this->isEmpty()) {
+            this->error("deque is empty");
+        }
+        return this->getSequence()->accessFirst()->data_;
+    }
+
+    template<typename T>
+    T& ImplicitDeque<T>::peekBack()
+    {
+        if (this->isEmpty()) {
+            this->error("deque is empty");
+        }
+        return this->getSequence()->accessLast()->data_;
+    }
+
+    template<typename T>
+    T ImplicitDeque<T>::popFront()
+    {
+        T result = this->peekFront();
+        this->getSequence()->removeFirst();
+        return result;
+    }
+
+    template<typename T>
+    T ImplicitDeque<T>::popBack()
+    {
+        T result = this->peekBack();
+        this->getSequence()->removeLast();
+        return result;
+    }
+
+    template<typename T>
+    void ImplicitDeque<T>::push(T element)
+    {
+        this->pushBack(element);
+    }
+
+    template<typename T>
+    T& ImplicitDeque<T>::peek()
+    {
+        return this->peekFront();
+    }
+
+    template<typename T>
+    T ImplicitDeque<T>::pop()
+    {
+        return this->popFront();
+    }
+
     template<typename T>
-    amt::CIS<T>* ImplicitQueue<T>::getSequence() const
+    amt::RingIS<T>* ImplicitDeque<T>::getSequence() const
     {
-        return dynamic_cast<amt::CIS<T>*>(this->memoryStructure_);
+        return dynamic_cast<amt::RingIS<T>*>(this->memoryStructure_);
     }
 
     template<typename T>
@@ -51,6 +51,9 @@ namespace ds::adt
     {
     public:
         void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
+
+        template <typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare&& compare);
     };
 
     template <typename T>
@@ -60,8 +63,12 @@ namespace ds::adt
     public:
         void sort(std::vector<T>& is, std::function<bool(const T&, const T&)> compare) override;
 
+        template <typename Compare>
+        void sort(std::vector<T>& is, Compare&& compare);
+
     private:
-        void quick(std::vector<T>& is, std::function<bool(const T&, const T&)> compare, size_t min, size_t max);
+        template <typename Compare>
+        void quick(std::vector<T>& is, Compare& compare, size_t min, size_t max);
     };
 
     template <typename T>
@@ -71,8 +78,12 @@ namespace ds::adt
     public:
         void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
 
+        template <typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare&& compare);
+
     private:
-        void quick(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare, size_t min, size_t max);
+        template <typename Compare>
+        void quick(typename amt::ImplicitSequence<T>::BlockSpan blocks, Compare& compare, size_t min, size_t max);
     };
 
 
@@ -91,8 +102,12 @@ namespace ds::adt
     public:
         void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
 
+        template <typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare&& compare);
+
     private:
-        void shell(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare, size_t k);
+        template <typename Compare>
+        void shell(typename amt::ImplicitSequence<T>::BlockSpan blocks, Compare& compare, size_t k);
     };
 
     template <typename Key, typename T>
@@ -149,16 +164,24 @@ namespace ds::adt
     template<typename T>
     void BubbleSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
     {
+        this->sort(is, [&compare](const T& a, const T& b) { return compare(a, b); });
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void BubbleSort<T>::sort(amt::ImplicitSequence<T>& is, Compare&& compare)
+    {
+        typename amt::ImplicitSequence<T>::BlockSpan blocks = is.getBlocks();
         bool swapped;
         do
         {
             swapped = false;
-            for (size_t i = 0; i < is.size() - 1; ++i)
+            for (size_t i = 0; i + 1 < blocks.size(); ++i)
             {
-                if (compare(is.access(i + 1)->data_, is.access(i)->data_))
+                if (compare(blocks[i + 1].data_, blocks[i].data_))
                 {
                     using std::swap;
-                    swap(is.access(i + 1)->data_, is.access(i)->data_);
+                    swap(blocks[i + 1].data_, blocks[i].data_);
                     swapped = true;
                 }
             }
@@ -168,6 +191,13 @@ namespace ds::adt
 
     template<typename T>
     void QuickSortVector<T>::sort(std::vector<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        this->sort(is, [&compare](const T& a, const T& b) { return compare(a, b); });
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void QuickSortVector<T>::sort(std::vector<T>& is, Compare&& compare)
     {
         if (!is.size()==0)
         {
@@ -176,7 +206,8 @@ namespace ds::adt
     }
 
     template<typename T>
-    void QuickSortVector<T>::quick(std::vector<T>& is, std::function<bool(const T&, const T&)> compare, size_t min, size_t max)
+    template<typename Compare>
+    void QuickSortVector<T>::quick(std::vector<T>& is, Compare& compare, size_t min, size_t max)
     {
         auto pivot = is.at(min + (max - min) / 2);
         auto left = min;
@@ -206,28 +237,36 @@ namespace ds::adt
     }
     template<typename T>
     void QuickSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        this->sort(is, [&compare](const T& a, const T& b) { return compare(a, b); });
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void QuickSort<T>::sort(amt::ImplicitSequence<T>& is, Compare&& compare)
     {
         if (!is.size() == 0)
         {
-            quick(is, compare, 0, is.size() - 1);
+            quick(is.getBlocks(), compare, 0, is.size() - 1);
         }
     }
 
     template<typename T>
-    void QuickSort<T>::quick(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare, size_t min, size_t max)
+    template<typename Compare>
+    void QuickSort<T>::quick(typename amt::ImplicitSequence<T>::BlockSpan blocks, Compare& compare, size_t min, size_t max)
     {
-        auto pivot = is.access(min + (max - min) / 2)->data_;
+        auto pivot = blocks[min + (max - min) / 2].data_;
         auto left = min;
         auto right = max;
         do {
-            while (compare(is.access(left)->data_, pivot)) {
+            while (compare(blocks[left].data_, pivot)) {
                 ++left;
             }
-            while (right > 0 && compare(pivot, is.access(right)->data_)) {
+            while (right > 0 && compare(pivot, blocks[right].data_)) {
                 --right;
             }
             if (left <= right) {
-                std::swap(is.access(left)->data_, is.access(right)->data_);
+                std::swap(blocks[left].data_, blocks[right].data_);
                 ++left;
                 if (right > 0) {
                     --right;
@@ -236,10 +275,10 @@ namespace ds::adt
 
         } while (left <= right);
         if (min < right) {
-            quick(is, compare, min, right);
+            quick(blocks, compare, min, right);
         }
         if (left < max) {
-            quick(is, compare, left, max);
+            quick(blocks, compare, left, max);
         }
     }
     template<typename T>
@@ -253,25 +292,36 @@ namespace ds::adt
     template<typename T>
     void ShellSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
     {
-        shell(is, compare, std::log10(is.size()));
+        this->sort(is, [&compare](const T& a, const T& b) { return compare(a, b); });
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ShellSort<T>::sort(amt::ImplicitSequence<T>& is, Compare&& compare)
+    {
+        if (!is.size() == 0)
+        {
+            shell(is.getBlocks(), compare, std::log10(is.size()));
+        }
     }
 
     template<typename T>
-    void ShellSort<T>::shell(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare, size_t k)
+    template<typename Compare>
+    void ShellSort<T>::shell(typename amt::ImplicitSequence<T>::BlockSpan blocks, Compare& compare, size_t k)
     {
         for (size_t d = 0; d <= k; d++)
         {
-            for (size_t i = 0; i <= is.size() -1 ; i++)
+            for (size_t i = 0; i <= blocks.size() -1 ; i++)
             {
                 int j = i;
-                while (j >= k && j - k >= d && compare(is.access(j)->data_, is.access(j - k)->data_)) {
-                    std::swap(is.access(j)->data_, is.access(j - k)->data_);
+                while (j >= k && j - k >= d && compare(blocks[j].data_, blocks[j - k].data_)) {
+                    std::swap(blocks[j].data_, blocks[j - k].data_);
                     j = j - k;
                 }
             }
         }
         if (k > 1) {
-            shell(is, compare, k - 1);
+            shell(blocks, compare, k - 1);
         }
     }
 
@@ -2,6 +2,8 @@
 
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_hierarchy.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/amt/chunked_implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
 
 namespace ds::adt {
@@ -18,7 +20,11 @@ namespace ds::adt {
 
     //----------
 
-    template<typename T>
+    /**
+     * @brief Stack stored in an implicit sequence of type @p SequenceType.
+     * With amt::ChunkedIS growth does not copy the elements and references returned by peek stay valid.
+     */
+    template<typename T, typename SequenceType = amt::IS<T>>
     class ImplicitStack :
         public Stack<T>,
         public ADS<T>
@@ -32,9 +38,12 @@ namespace ds::adt {
         T pop() override;
 
     private:
-        amt::IS<T>* getSequence() const;
+        SequenceType* getSequence() const;
     };
 
+    template<typename T>
+    using ChunkedStack = ImplicitStack<T, amt::ChunkedIS<T>>;
+
     //----------
 
     template<typename T>
@@ -56,37 +65,37 @@ namespace ds::adt {
 
     //----------
 
-    template<typename T>
-    ImplicitStack<T>::ImplicitStack() :
-        ADS<T>(new amt::IS<T>())
+    template<typename T, typename SequenceType>
+    ImplicitStack<T, SequenceType>::ImplicitStack() :
+        ADS<T>(new SequenceType())
     {
     }
 
-    template<typename T>
-    ImplicitStack<T>::ImplicitStack(const ImplicitStack& other) :
-        ADS<T>(new amt::IS<T>(), other)
+    template<typename T, typename SequenceType>
+    ImplicitStack<T, SequenceType>::ImplicitStack(const ImplicitStack& other) :
+        ADS<T>(new SequenceType(), other)
     {
     }
 
-    template<typename T>
-    void ImplicitStack<T>::push(T element)
+    template<typename T, typename SequenceType>
+    void ImplicitStack<T, SequenceType>::push(T element)
     {
-        this->getSequence()->insertLast()->data_ = element;
+        this->getSequence()->insertLast().data_ = element;
     }
 
-    template<typename T>
-    T& ImplicitStack<T>::peek()
+    template<typename T, typename SequenceType>
+    T& ImplicitStack<T, SequenceType>::peek()
     {
-        if (isEmpty()) {
+        if (this->isEmpty()) {
             throw std::range_error("Stack is empty");
         }
         return this->getSequence()->accessLast()->data_;
     }
 
-    template<typename T>
-    T ImplicitStack<T>::pop()
+    template<typename T, typename SequenceType>
+    T ImplicitStack<T, SequenceType>::pop()
     {
-        if (isEmpty()) {
+        if (this->isEmpty()) {
             throw std::range_error("Stack is empty");
         }
         auto result = this->getSequence()->accessLast()->data_;
@@ -94,10 +103,10 @@ namespace ds::adt {
         return result;
     }
 
-    template<typename T>
-    amt::IS<T>* ImplicitStack<T>::getSequence() const
+    template<typename T, typename SequenceType>
+    SequenceType* ImplicitStack<T, SequenceType>::getSequence() const
     {
-        return dynamic_cast<amt::IS<T>*>(this->memoryStructure_);
+        return dynamic_cast<SequenceType*>(this->memoryStructure_);
     }
 
     template<typename T>
@@ -121,7 +130,7 @@ namespace ds::adt {
     template<typename T>
     T& ExplicitStack<T>::peek()
     {
-        if (isEmpty()) {
+        if (this->isEmpty()) {
             throw std::range_error("Stack is empty");
         }
         return this->getSequence()->accessFirst()->data_;
@@ -130,7 +139,7 @@ namespace ds::adt {
     template<typename T>
     T ExplicitStack<T>::pop()
     {
-        if (isEmpty()) {
+        if (this->isEmpty()) {
             throw std::range_error("Stack is empty");
         }
         auto result = this->getSequence()->accessFirst()->data_;
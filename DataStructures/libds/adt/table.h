@@ -8,6 +8,10 @@
 #include <random>
 #include <string>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
 namespace ds::adt {
 
     template <typename K, typename T>
@@ -133,6 +137,120 @@ namespace ds::adt {
 
     //----------
 
+    namespace details
+    {
+        /**
+         * @brief Hints the processor to load the cache line containing @p address.
+         */
+        inline void prefetch(const void* address)
+        {
+#if defined(__GNUG__)
+            __builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+            (void)address;
+#endif
+        }
+    }
+
+    /**
+     * @brief Immutable table for lookups, built once from items sorted by strictly increasing keys.
+     *
+     * Keys are stored in Eytzinger order, i.e. as a complete binary search tree in level order
+     * where node k (counted from 1) has sons 2k and 2k + 1. The search does not branch on keys
+     * and prefetches the cache line holding the keys of the nodes four levels below.
+     * Item of node k is stored at index k - 1.
+     */
+    template <typename K, typename T>
+    class EytzingerTable :
+        public Table<K, T>,
+        public ADS<TabItem<K, T>>
+    {
+    public:
+        EytzingerTable();
+        EytzingerTable(const EytzingerTable& other);
+        explicit EytzingerTable(SortedSequenceTable<K, T>& table);
+
+        /**
+         * @brief Builds the table from the forward range [first, last) of items sorted by keys.
+         */
+        template <typename Iterator>
+        EytzingerTable(Iterator first, Iterator last);
+
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+
+        void insert(K key, T data) override;
+        bool tryFind(K key, T*& data) override;
+        T remove(K key) override;
+
+    private:
+        using KeyBlockType = amt::MemoryBlock<K>;
+
+    private:
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+        static constexpr size_t PREFETCH_STRIDE = CACHE_LINE_SIZE / sizeof(KeyBlockType) > 0
+            ? CACHE_LINE_SIZE / sizeof(KeyBlockType)
+            : 1;
+
+    private:
+        amt::IS<TabItem<K, T>>* getItems() const;
+
+        /**
+         * @brief Returns the first node whose key is not less than @p key, 0 if there is none.
+         */
+        size_t lowerBoundNode(const K& key) const;
+
+        size_t firstNode() const;
+        size_t nextNode(size_t node) const;
+
+    private:
+        // Slot 0 is unused so the keys of sons of a node share a cache line.
+        amt::IS<K> keys_;
+
+    public:
+        class EytzingerTableIterator
+        {
+        public:
+            EytzingerTableIterator(const EytzingerTable<K, T>* table, size_t node);
+            EytzingerTableIterator(const EytzingerTableIterator& other);
+            EytzingerTableIterator& operator++();
+            EytzingerTableIterator operator++(int);
+            bool operator==(const EytzingerTableIterator& other) const;
+            bool operator!=(const EytzingerTableIterator& other) const;
+            TabItem<K, T>& operator*();
+
+        private:
+            const EytzingerTable<K, T>* table_;
+            size_t node_;
+        };
+
+        using IteratorType = EytzingerTableIterator;
+
+        /**
+         * @brief Iterates items in the order of keys.
+         */
+        IteratorType begin() const;
+        IteratorType end() const;
+
+        /**
+         * @brief Returns iterator to the first item whose key is not less than @p key.
+         */
+        IteratorType lowerBound(K key) const;
+
+        /**
+         * @brief Calls @p operation on every item with key in [first, last) in the order of keys.
+         */
+        template <typename Operation>
+        void processRange(K first, K last, Operation operation) const;
+    };
+
+    template <typename K, typename T>
+    using EytzingerTab = EytzingerTable<K, T>;
+
+    //----------
+
     template <typename K, typename T>
     class HashTable :
         public Table<K, T>,
@@ -464,7 +582,7 @@ namespace ds::adt {
             indexMiddle = firstIndex + (lastIndex - firstIndex) / 2;
             lastBlock = this->getSequence()->access(indexMiddle);
             if (lastBlock->data_.key_ < key) {
-                firstIndex = indexMiddle++;
+                firstIndex = indexMiddle + 1;
             }
             else if (lastBlock->data_.key_ > key) {
                 lastIndex = indexMiddle;
@@ -483,6 +601,249 @@ namespace ds::adt {
 
     //----------
 
+    template<typename K, typename T>
+    EytzingerTable<K, T>::EytzingerTable() :
+        ADS<TabItem<K, T>>(new amt::IS<TabItem<K, T>>()),
+        keys_(new mm::CompactMemoryManager<KeyBlockType>(1, new mm::GeometricGrowthPolicy(), CACHE_LINE_SIZE))
+    {
+        keys_.insertLast();
+    }
+
+    template<typename K, typename T>
+    EytzingerTable<K, T>::EytzingerTable(const EytzingerTable& other) :
+        ADS<TabItem<K, T>>(new amt::IS<TabItem<K, T>>(), other),
+        keys_(new mm::CompactMemoryManager<KeyBlockType>(1, new mm::GeometricGrowthPolicy(), CACHE_LINE_SIZE))
+    {
+        keys_.assign(other.keys_);
+    }
+
+    template<typename K, typename T>
+    EytzingerTable<K, T>::EytzingerTable(SortedSequenceTable<K, T>& table) :
+        EytzingerTable(table.begin(), table.end())
+    {
+    }
+
+    template<typename K, typename T>
+    template<typename Iterator>
+    EytzingerTable<K, T>::EytzingerTable(Iterator first, Iterator last) :
+        EytzingerTable()
+    {
+        size_t count = 0;
+        const K* previousKey = nullptr;
+        for (Iterator it = first; it != last; ++it)
+        {
+            const K& key = (*it).key_;
+            if (previousKey != nullptr && !(*previousKey < key))
+            {
+                this->error("Keys are not strictly increasing!");
+            }
+            previousKey = &key;
+            ++count;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Items are filled by an in-order walk of the tree, which visits nodes in the order of keys.
+        auto* items = this->getItems();
+        items->insertBlocks(0, count);
+        keys_.insertBlocks(1, count);
+        auto itemBlocks = items->getBlocks();
+        auto keyBlocks = keys_.getBlocks();
+        size_t node = this->firstNode();
+        for (Iterator it = first; it != last; ++it)
+        {
+            itemBlocks[node - 1].data_ = *it;
+            keyBlocks[node].data_ = (*it).key_;
+            node = this->nextNode(node);
+        }
+    }
+
+    template<typename K, typename T>
+    ADT& EytzingerTable<K, T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            ADS<TabItem<K, T>>::assign(other);
+            keys_.assign(dynamic_cast<const EytzingerTable<K, T>&>(other).keys_);
+        }
+
+        return *this;
+    }
+
+    template<typename K, typename T>
+    void EytzingerTable<K, T>::clear()
+    {
+        ADS<TabItem<K, T>>::clear();
+        keys_.clear();
+        keys_.insertLast();
+    }
+
+    template<typename K, typename T>
+    void EytzingerTable<K, T>::insert(K /*key*/, T /*data*/)
+    {
+        throw structure_error("Eytzinger table is immutable!");
+    }
+
+    template<typename K, typename T>
+    bool EytzingerTable<K, T>::tryFind(K key, T*& data)
+    {
+        const size_t node = this->lowerBoundNode(key);
+        if (node == 0 || key < keys_.access(node)->data_)
+        {
+            return false;
+        }
+        data = &this->getItems()->access(node - 1)->data_.data_;
+        return true;
+    }
+
+    template<typename K, typename T>
+    T EytzingerTable<K, T>::remove(K /*key*/)
+    {
+        throw structure_error("Eytzinger table is immutable!");
+    }
+
+    template<typename K, typename T>
+    amt::IS<TabItem<K, T>>* EytzingerTable<K, T>::getItems() const
+    {
+        return dynamic_cast<amt::IS<TabItem<K, T>>*>(this->memoryStructure_);
+    }
+
+    template<typename K, typename T>
+    size_t EytzingerTable<K, T>::lowerBoundNode(const K& key) const
+    {
+        const KeyBlockType* keys = keys_.access(0);
+        const size_t nodeCount = keys_.size() - 1;
+        size_t node = 1;
+        while (node <= nodeCount)
+        {
+            if (node * PREFETCH_STRIDE <= nodeCount)
+            {
+                details::prefetch(keys + node * PREFETCH_STRIDE);
+            }
+            node = 2 * node + static_cast<size_t>(keys[node].data_ < key);
+        }
+
+        // Each right turn appended 1, the last left turn was made at the searched node.
+        return node >> (amt::details::floorLog2(node ^ (node + 1)) + 1);
+    }
+
+    template<typename K, typename T>
+    size_t EytzingerTable<K, T>::firstNode() const
+    {
+        const size_t nodeCount = keys_.size() - 1;
+        if (nodeCount == 0)
+        {
+            return 0;
+        }
+
+        size_t node = 1;
+        while (2 * node <= nodeCount)
+        {
+            node *= 2;
+        }
+        return node;
+    }
+
+    template<typename K, typename T>
+    size_t EytzingerTable<K, T>::nextNode(size_t node) const
+    {
+        const size_t nodeCount = keys_.size() - 1;
+        if (2 * node + 1 <= nodeCount)
+        {
+            node = 2 * node + 1;
+            while (2 * node <= nodeCount)
+            {
+                node *= 2;
+            }
+            return node;
+        }
+
+        // Returns to the nearest ancestor whose left subtree contains the node.
+        return node >> (amt::details::floorLog2(node ^ (node + 1)) + 1);
+    }
+
+    template<typename K, typename T>
+    auto EytzingerTable<K, T>::begin() const -> IteratorType
+    {
+        return IteratorType(this, this->firstNode());
+    }
+
+    template<typename K, typename T>
+    auto EytzingerTable<K, T>::end() const -> IteratorType
+    {
+        return IteratorType(this, 0);
+    }
+
+    template<typename K, typename T>
+    auto EytzingerTable<K, T>::lowerBound(K key) const -> IteratorType
+    {
+        return IteratorType(this, this->lowerBoundNode(key));
+    }
+
+    template<typename K, typename T>
+    template<typename Operation>
+    void EytzingerTable<K, T>::processRange(K first, K last, Operation operation) const
+    {
+        const KeyBlockType* keys = keys_.access(0);
+        auto itemBlocks = this->getItems()->getBlocks();
+        for (size_t node = this->lowerBoundNode(first); node != 0 && keys[node].data_ < last; node = this->nextNode(node))
+        {
+            operation(itemBlocks[node - 1].data_);
+        }
+    }
+
+    template<typename K, typename T>
+    EytzingerTable<K, T>::EytzingerTableIterator::EytzingerTableIterator(const EytzingerTable<K, T>* table, size_t node) :
+        table_(table),
+        node_(node)
+    {
+    }
+
+    template<typename K, typename T>
+    EytzingerTable<K, T>::EytzingerTableIterator::EytzingerTableIterator(const EytzingerTableIterator& other) :
+        table_(other.table_),
+        node_(other.node_)
+    {
+    }
+
+    template<typename K, typename T>
+    auto EytzingerTable<K, T>::EytzingerTableIterator::operator++() -> EytzingerTableIterator&
+    {
+        node_ = table_->nextNode(node_);
+        return *this;
+    }
+
+    template<typename K, typename T>
+    auto EytzingerTable<K, T>::EytzingerTableIterator::operator++(int) -> EytzingerTableIterator
+    {
+        EytzingerTableIterator tmp(*this);
+        operator++();
+        return tmp;
+    }
+
+    template<typename K, typename T>
+    bool EytzingerTable<K, T>::EytzingerTableIterator::operator==(const EytzingerTableIterator& other) const
+    {
+        return table_ == other.table_ && node_ == other.node_;
+    }
+
+    template<typename K, typename T>
+    bool EytzingerTable<K, T>::EytzingerTableIterator::operator!=(const EytzingerTableIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template<typename K, typename T>
+    TabItem<K, T>& EytzingerTable<K, T>::EytzingerTableIterator::operator*()
+    {
+        return table_->getItems()->access(node_ - 1)->data_;
+    }
+
+    //----------
+
     template<typename K, typename T>
     HashTable<K, T>::HashTable() :
         HashTable([](K key) { return std::hash<K>()(key); }, CAPACITY)
@@ -78,7 +78,10 @@ namespace ds::adt {
         static NodeType* getNode(Node* node);
         static NodeType& getNode(Node& node);
         static const NodeType& getNode(const Node& node);
-        HierarchyType* getHierarchy() const;
+        const amt::StaticHierarchy<HierarchyType>* getHierarchy() const;
+
+    private:
+        amt::StaticHierarchy<HierarchyType> hierarchy_;
     };
 
     //----------
@@ -120,13 +123,15 @@ namespace ds::adt {
 
     template <typename T, typename HierarchyType>
     GeneralTree<T, HierarchyType>::GeneralTree() :
-        ADS<T>(new HierarchyType())
+        ADS<T>(new HierarchyType()),
+        hierarchy_(dynamic_cast<HierarchyType*>(this->memoryStructure_))
     {
     }
 
     template <typename T, typename HierarchyType>
     GeneralTree<T, HierarchyType>::GeneralTree(const GeneralTree& other) :
-        ADS<T>(new HierarchyType(), other)
+        ADS<T>(new HierarchyType(), other),
+        hierarchy_(dynamic_cast<HierarchyType*>(this->memoryStructure_))
     {
     }
 
@@ -256,8 +261,8 @@ namespace ds::adt {
     }
 
     template <typename T, typename HierarchyType>
-    HierarchyType* GeneralTree<T, HierarchyType>::getHierarchy() const
+    auto GeneralTree<T, HierarchyType>::getHierarchy() const -> const amt::StaticHierarchy<HierarchyType>*
     {
-        return static_cast<HierarchyType*>(this->memoryStructure_);
+        return &hierarchy_;
     }
 }
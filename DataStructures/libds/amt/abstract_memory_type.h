@@ -2,7 +2,10 @@
 
 #include <libds/constants.h>
 #include <libds/mm/compact_memory_manager.h>
+#include <libds/mm/monotonic_arena_memory_manager.h>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
 
 namespace ds::amt {
 
@@ -28,6 +31,53 @@ namespace ds::amt {
 		DataType data_;
 	};
 
+	namespace details {
+
+		/**
+		 * @brief Returns the smallest power of two not less than @p n.
+		 */
+		constexpr size_t ceilPowerOfTwo(size_t n)
+		{
+			size_t result = 1;
+			while (result < n)
+			{
+				result <<= 1;
+			}
+			return result;
+		}
+
+		/**
+		 * @brief Node with members of @p Data aligned to its size rounded up to a power of two.
+		 * A node holds its blocks in the array blocks_, so the node containing a block
+		 * is found by masking the address of the block. Memory managers of nodes
+		 * have to honour the alignment, MemoryManager allocates them by alignedAllocate.
+		 */
+		template<typename Data>
+		struct alignas(ceilPowerOfTwo(sizeof(Data))) AlignedNode :
+			public Data
+		{
+		};
+
+		/**
+		 * @brief Returns the aligned node of type @p Node containing @p block.
+		 */
+		template<typename Node, typename Block>
+		Node* nodeOfBlock(const Block& block)
+		{
+			return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(&block) & ~(alignof(Node) - 1));
+		}
+
+		/**
+		 * @brief Returns index of @p block in the array blocks_ of @p node.
+		 */
+		template<typename Node, typename Block>
+		size_t indexInNode(const Node* node, const Block& block)
+		{
+			return static_cast<size_t>(&block - node->blocks_);
+		}
+
+	}
+
 	//----------
 
 	class AbstractMemoryType
@@ -56,6 +106,12 @@ namespace ds::amt {
 		size_t size() const override;
 		bool isEmpty() const override { return size() == 0; }
 
+		/**
+		 * @brief Returns snapshot of statistics collected by the memory manager.
+		 * All counters are zero unless DS_MM_STATISTICS is defined.
+		 */
+		mm::MemoryStatistics getMemoryStatistics() const;
+
 	protected:
 		mm::MemoryManager<BlockType>* memoryManager_;
 	};
@@ -75,6 +131,7 @@ namespace ds::amt {
 
 		ImplicitAbstractMemoryStructure();
 		ImplicitAbstractMemoryStructure(size_t capacity, bool initBlocks);
+		ImplicitAbstractMemoryStructure(size_t capacity, mm::GrowthPolicy* growthPolicy);
 		ImplicitAbstractMemoryStructure(MemoryManagerType* memoryManager);
 		ImplicitAbstractMemoryStructure(const ImplicitAbstractMemoryStructure<DataType>& other);
 
@@ -89,6 +146,13 @@ namespace ds::amt {
 
 	protected:
 		mm::CompactMemoryManager<BlockType>* getMemoryManager() const;
+
+	private:
+		/**
+		 * @brief Same object as memoryManager_ kept with its concrete type,
+		 * so getMemoryManager does not need a dynamic_cast.
+		 */
+		MemoryManagerType* compactMemoryManager_;
 	};
 
 	template<typename DataType>
@@ -103,6 +167,14 @@ namespace ds::amt {
 	public:
 		ExplicitAbstractMemoryStructure();
 		ExplicitAbstractMemoryStructure(mm::MemoryManager<BlockType>* memoryManager);
+
+	protected:
+		/**
+		 * @brief Releases all blocks at once if the memory manager is an arena
+		 * and blocks do not need to be destroyed.
+		 * @return true if blocks were released, false if they have to be released one by one.
+		 */
+		bool tryReleaseAllBlocks();
 	};
 
 	template<typename BlockType>
@@ -220,6 +292,12 @@ namespace ds::amt {
 		return memoryManager_->getAllocatedBlockCount();
 	}
 
+	template<typename BlockType>
+    mm::MemoryStatistics AbstractMemoryStructure<BlockType>::getMemoryStatistics() const
+	{
+		return memoryManager_->getStatistics();
+	}
+
 	template<typename DataType>
     ImplicitAbstractMemoryStructure<DataType>::ImplicitAbstractMemoryStructure():
 		ImplicitAbstractMemoryStructure<DataType>(INIT_CAPACITY, false)
@@ -228,7 +306,7 @@ namespace ds::amt {
 
 	template<typename DataType>
     ImplicitAbstractMemoryStructure<DataType>::ImplicitAbstractMemoryStructure(size_t capacity, bool initBlocks) :
-		AMS<MemoryBlock<DataType>>(new mm::CompactMemoryManager<BlockType>(capacity))
+		ImplicitAbstractMemoryStructure<DataType>(new mm::CompactMemoryManager<BlockType>(capacity))
 	{
 		if (initBlocks)
 		{
@@ -239,15 +317,22 @@ namespace ds::amt {
 		}
 	}
 
+	template<typename DataType>
+    ImplicitAbstractMemoryStructure<DataType>::ImplicitAbstractMemoryStructure(size_t capacity, mm::GrowthPolicy* growthPolicy) :
+		ImplicitAbstractMemoryStructure<DataType>(new mm::CompactMemoryManager<BlockType>(capacity, growthPolicy))
+	{
+	}
+
 	template<typename DataType>
     ImplicitAbstractMemoryStructure<DataType>::ImplicitAbstractMemoryStructure(mm::CompactMemoryManager<BlockType>* memoryManager):
-		AMS<MemoryBlock<DataType>>(memoryManager)
+		AMS<MemoryBlock<DataType>>(memoryManager),
+		compactMemoryManager_(memoryManager)
 	{
 	}
 
 	template<typename DataType>
     ImplicitAbstractMemoryStructure<DataType>::ImplicitAbstractMemoryStructure(const ImplicitAbstractMemoryStructure<DataType>& other):
-		AMS<MemoryBlock<DataType>>(new mm::CompactMemoryManager<BlockType>(*other.getMemoryManager()))
+		ImplicitAbstractMemoryStructure<DataType>(new mm::CompactMemoryManager<BlockType>(*other.getMemoryManager()))
 	{
 	}
 
@@ -295,7 +380,7 @@ namespace ds::amt {
 	template<typename DataType>
     mm::CompactMemoryManager<MemoryBlock<DataType>>* ImplicitAbstractMemoryStructure<DataType>::getMemoryManager() const
 	{
-		return dynamic_cast<mm::CompactMemoryManager<BlockType>*>(AMS<BlockType>::memoryManager_);
+		return compactMemoryManager_;
 	}
 
 	template<typename BlockType>
@@ -310,4 +395,20 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename BlockType>
+	bool ExplicitAbstractMemoryStructure<BlockType>::tryReleaseAllBlocks()
+	{
+		if constexpr (std::is_trivially_destructible_v<BlockType>)
+		{
+			auto* arena = dynamic_cast<mm::MonotonicArenaMemoryManager<BlockType>*>(AMS<BlockType>::memoryManager_);
+			if (arena != nullptr)
+			{
+				arena->releaseAll();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,644 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/sequence.h>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::amt {
+
+	namespace details {
+
+		/**
+		 * @brief Returns how many blocks fit into a chunk of @p ChunkSize bytes next to its header, at least one.
+		 */
+		template<typename DataType, size_t ChunkSize>
+		constexpr size_t chunkCapacity()
+		{
+			constexpr size_t blockSize = sizeof(MemoryBlock<DataType>);
+			return ChunkSize > sizeof(size_t) + blockSize ? (ChunkSize - sizeof(size_t)) / blockSize : 1;
+		}
+
+	}
+
+	template<typename DataType, size_t N>
+	struct ChunkedImplicitSequenceChunkData
+	{
+		ChunkedImplicitSequenceChunkData() : slot_(0) {}
+
+		size_t slot_;
+		MemoryBlock<DataType> blocks_[N];
+	};
+
+	/**
+	 * @brief Chunk of N blocks of a chunked implicit sequence, remembering its slot in the chunk table.
+	 * The slot is stored relative to the offset of the table, so moving the table does not touch chunks.
+	 */
+	template<typename DataType, size_t N>
+	struct ChunkedImplicitSequenceChunk :
+		public details::AlignedNode<ChunkedImplicitSequenceChunkData<DataType, N>>
+	{
+	};
+
+	//----------
+
+	/**
+	 * @brief Sequence of blocks stored in fixed-size chunks addressed through a table of chunks.
+	 *
+	 * A chunk takes about @p ChunkSize bytes. Block at index i is at position front + i,
+	 * where position p lies in the chunk at slot p / CHUNK_CAPACITY of the table.
+	 * Access by index is O(1) and insertFirst and insertLast are amortized O(1).
+	 * Growth never copies blocks, only the table of chunk pointers is reallocated,
+	 * so references to blocks inserted at either end stay valid until the block
+	 * is removed. Insert and remove in the middle shift the shorter side by one.
+	 */
+	template<typename DataType, size_t ChunkSize>
+	class ChunkedImplicitSequence :
+		public Sequence<MemoryBlock<DataType>>,
+		public ExplicitAMS<ChunkedImplicitSequenceChunk<DataType, details::chunkCapacity<DataType, ChunkSize>()>>
+	{
+	public:
+		static constexpr size_t CHUNK_CAPACITY = details::chunkCapacity<DataType, ChunkSize>();
+
+		using BlockType = MemoryBlock<DataType>;
+		using ChunkType = ChunkedImplicitSequenceChunk<DataType, CHUNK_CAPACITY>;
+
+		ChunkedImplicitSequence();
+		ChunkedImplicitSequence(size_t size, bool initBlocks);
+		ChunkedImplicitSequence(mm::MemoryManager<ChunkType>* memoryManager);
+		ChunkedImplicitSequence(const ChunkedImplicitSequence& other);
+		~ChunkedImplicitSequence() override;
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		size_t size() const override;
+		bool equals(const AMT& other) override;
+
+		size_t calculateIndex(BlockType& block) override;
+
+		BlockType* accessFirst() const override;
+		BlockType* accessLast() const override;
+		BlockType* access(size_t index) const override;
+		BlockType* accessNext(const BlockType& block) const override;
+		BlockType* accessPrevious(const BlockType& block) const override;
+
+		BlockType& insertFirst() override;
+		BlockType& insertLast() override;
+		BlockType& insert(size_t index) override;
+		BlockType& insertAfter(BlockType& block) override;
+		BlockType& insertBefore(BlockType& block) override;
+
+		void removeFirst() override;
+		void removeLast() override;
+		void remove(size_t index) override;
+		void removeNext(const BlockType& block) override;
+		void removePrevious(const BlockType& block) override;
+
+		void processAllBlocksForward(std::function<void(BlockType*)> operation) const override;
+		void processAllBlocksBackward(std::function<void(BlockType*)> operation) const override;
+		BlockType* findBlockWithProperty(std::function<bool(BlockType*)> predicate) const override;
+
+		/**
+		 * @brief Calls @p operation on all blocks, chunk by chunk.
+		 */
+		template<typename Operation>
+		void forEach(Operation&& operation) const;
+		template<typename Operation>
+		void forEachBackward(Operation&& operation) const;
+		template<typename Predicate>
+		BlockType* findBlock(Predicate&& predicate) const;
+
+		size_t getChunkCount() const;
+
+	private:
+		static constexpr size_t MIN_TABLE_CAPACITY = 8;
+
+
+		size_t positionOf(const BlockType& block) const;
+		BlockType& blockAt(size_t position) const;
+		void ensureChunk(size_t position);
+		void releaseChunkIfUnused(size_t slot);
+		void recenterTable();
+
+	private:
+		ChunkType** table_;
+		size_t tableCapacity_;
+		size_t slotOffset_;
+		size_t front_;
+		size_t size_;
+
+	public:
+		class ChunkedImplicitSequenceIterator
+		{
+		public:
+			ChunkedImplicitSequenceIterator(ChunkedImplicitSequence<DataType, ChunkSize>* sequence, size_t index);
+			ChunkedImplicitSequenceIterator& operator++();
+			ChunkedImplicitSequenceIterator operator++(int);
+			bool operator==(const ChunkedImplicitSequenceIterator& other) const;
+			bool operator!=(const ChunkedImplicitSequenceIterator& other) const;
+			DataType& operator*();
+
+		private:
+			ChunkedImplicitSequence<DataType, ChunkSize>* sequence_;
+			size_t position_;
+		};
+
+		using IteratorType = ChunkedImplicitSequenceIterator;
+
+		IteratorType begin();
+		IteratorType end();
+	};
+
+	template<typename DataType, size_t ChunkSize = 4096>
+	using ChunkedIS = ChunkedImplicitSequence<DataType, ChunkSize>;
+
+	//----------
+
+	template<typename DataType, size_t ChunkSize>
+	ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequence() :
+		table_(nullptr),
+		tableCapacity_(0),
+		slotOffset_(0),
+		front_(0),
+		size_(0)
+	{
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequence(size_t size, bool initBlocks) :
+		ChunkedImplicitSequence()
+	{
+		if (initBlocks)
+		{
+			for (size_t i = 0; i < size; ++i)
+			{
+				this->insertLast();
+			}
+		}
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequence(mm::MemoryManager<ChunkType>* memoryManager) :
+		ExplicitAMS<ChunkType>(memoryManager),
+		table_(nullptr),
+		tableCapacity_(0),
+		slotOffset_(0),
+		front_(0),
+		size_(0)
+	{
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequence(const ChunkedImplicitSequence& other) :
+		ChunkedImplicitSequence()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	ChunkedImplicitSequence<DataType, ChunkSize>::~ChunkedImplicitSequence()
+	{
+		ChunkedImplicitSequence<DataType, ChunkSize>::clear();
+		delete[] table_;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	AMT& ChunkedImplicitSequence<DataType, ChunkSize>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+
+			const ChunkedImplicitSequence<DataType, ChunkSize>& otherSequence = dynamic_cast<const ChunkedImplicitSequence<DataType, ChunkSize>&>(other);
+			otherSequence.forEach([this](const BlockType* block)
+				{
+					this->insertLast().data_ = block->data_;
+				});
+		}
+
+		return *this;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::clear()
+	{
+		if (size_ != 0)
+		{
+			const bool released = this->tryReleaseAllBlocks();
+			for (size_t slot = front_ / CHUNK_CAPACITY; slot <= (front_ + size_ - 1) / CHUNK_CAPACITY; ++slot)
+			{
+				if (!released)
+				{
+					AMS<ChunkType>::memoryManager_->releaseMemory(table_[slot]);
+				}
+				table_[slot] = nullptr;
+			}
+		}
+
+		front_ = tableCapacity_ / 2 * CHUNK_CAPACITY;
+		size_ = 0;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	size_t ChunkedImplicitSequence<DataType, ChunkSize>::size() const
+	{
+		return size_;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	bool ChunkedImplicitSequence<DataType, ChunkSize>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		if (this->size() != other.size())
+		{
+			return false;
+		}
+
+		const ChunkedImplicitSequence<DataType, ChunkSize>* otherSequence = dynamic_cast<const ChunkedImplicitSequence<DataType, ChunkSize>*>(&other);
+		if (otherSequence == nullptr)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < size_; ++i)
+		{
+			if (!(this->blockAt(front_ + i).data_ == otherSequence->blockAt(otherSequence->front_ + i).data_))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	size_t ChunkedImplicitSequence<DataType, ChunkSize>::calculateIndex(BlockType& block)
+	{
+		// The chunk is looked up in the table instead of reading its slot, so that
+		// a block of another structure is not dereferenced.
+		const ChunkType* chunk = details::nodeOfBlock<ChunkType>(block);
+		const size_t end = front_ + size_;
+		for (size_t slot = front_ / CHUNK_CAPACITY; size_ != 0 && slot <= (end - 1) / CHUNK_CAPACITY; ++slot)
+		{
+			if (table_[slot] == chunk)
+			{
+				const size_t position = slot * CHUNK_CAPACITY + details::indexInNode(chunk, block);
+				return position >= front_ && position < end ? position - front_ : INVALID_INDEX;
+			}
+		}
+
+		return INVALID_INDEX;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::accessFirst() const -> BlockType*
+	{
+		return size_ > 0 ? &this->blockAt(front_) : nullptr;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::accessLast() const -> BlockType*
+	{
+		return size_ > 0 ? &this->blockAt(front_ + size_ - 1) : nullptr;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::access(size_t index) const -> BlockType*
+	{
+		return index < size_ ? &this->blockAt(front_ + index) : nullptr;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::accessNext(const BlockType& block) const -> BlockType*
+	{
+		const size_t position = this->positionOf(block) + 1;
+		return position < front_ + size_ ? &this->blockAt(position) : nullptr;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::accessPrevious(const BlockType& block) const -> BlockType*
+	{
+		const size_t position = this->positionOf(block);
+		return position > front_ ? &this->blockAt(position - 1) : nullptr;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::insertFirst() -> BlockType&
+	{
+		if (front_ == 0)
+		{
+			this->recenterTable();
+		}
+
+		--front_;
+		this->ensureChunk(front_);
+		++size_;
+
+		return this->blockAt(front_);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::insertLast() -> BlockType&
+	{
+		if (front_ + size_ == tableCapacity_ * CHUNK_CAPACITY)
+		{
+			this->recenterTable();
+		}
+
+		const size_t position = front_ + size_;
+		this->ensureChunk(position);
+		++size_;
+
+		return this->blockAt(position);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::insert(size_t index) -> BlockType&
+	{
+		if (index > size_)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (index < size_ / 2)
+		{
+			this->insertFirst();
+			for (size_t i = 0; i < index; ++i)
+			{
+				this->blockAt(front_ + i).data_ = std::move(this->blockAt(front_ + i + 1).data_);
+			}
+		}
+		else
+		{
+			this->insertLast();
+			for (size_t i = size_ - 1; i > index; --i)
+			{
+				this->blockAt(front_ + i).data_ = std::move(this->blockAt(front_ + i - 1).data_);
+			}
+		}
+
+		BlockType& block = this->blockAt(front_ + index);
+		block.data_ = DataType();
+		return block;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::insertAfter(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->positionOf(block) - front_ + 1);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::insertBefore(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->positionOf(block) - front_);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::removeFirst()
+	{
+		const size_t slot = front_ / CHUNK_CAPACITY;
+		this->blockAt(front_).data_ = DataType();
+		++front_;
+		--size_;
+		this->releaseChunkIfUnused(slot);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::removeLast()
+	{
+		--size_;
+		const size_t position = front_ + size_;
+		this->blockAt(position).data_ = DataType();
+		this->releaseChunkIfUnused(position / CHUNK_CAPACITY);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::remove(size_t index)
+	{
+		if (index >= size_)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (index < size_ / 2)
+		{
+			for (size_t i = index; i > 0; --i)
+			{
+				this->blockAt(front_ + i).data_ = std::move(this->blockAt(front_ + i - 1).data_);
+			}
+			this->removeFirst();
+		}
+		else
+		{
+			for (size_t i = index; i + 1 < size_; ++i)
+			{
+				this->blockAt(front_ + i).data_ = std::move(this->blockAt(front_ + i + 1).data_);
+			}
+			this->removeLast();
+		}
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::removeNext(const BlockType& block)
+	{
+		this->remove(this->positionOf(block) - front_ + 1);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::removePrevious(const BlockType& block)
+	{
+		this->remove(this->positionOf(block) - front_ - 1);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::processAllBlocksForward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEach(operation);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::processAllBlocksBackward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEachBackward(operation);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::findBlockWithProperty(std::function<bool(BlockType*)> predicate) const -> BlockType*
+	{
+		return this->findBlock(predicate);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	template<typename Operation>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::forEach(Operation&& operation) const
+	{
+		const size_t end = front_ + size_;
+		size_t position = front_;
+		while (position < end)
+		{
+			BlockType* const blocks = table_[position / CHUNK_CAPACITY]->blocks_;
+			const size_t chunkEnd = std::min(end, (position / CHUNK_CAPACITY + 1) * CHUNK_CAPACITY);
+			for (; position < chunkEnd; ++position)
+			{
+				operation(&blocks[position % CHUNK_CAPACITY]);
+			}
+		}
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	template<typename Operation>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::forEachBackward(Operation&& operation) const
+	{
+		size_t position = front_ + size_;
+		while (position > front_)
+		{
+			BlockType* const blocks = table_[(position - 1) / CHUNK_CAPACITY]->blocks_;
+			const size_t chunkBegin = std::max(front_, (position - 1) / CHUNK_CAPACITY * CHUNK_CAPACITY);
+			for (; position > chunkBegin; --position)
+			{
+				operation(&blocks[(position - 1) % CHUNK_CAPACITY]);
+			}
+		}
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	template<typename Predicate>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::findBlock(Predicate&& predicate) const -> BlockType*
+	{
+		const size_t end = front_ + size_;
+		for (size_t position = front_; position < end; ++position)
+		{
+			BlockType* block = &this->blockAt(position);
+			if (predicate(block))
+			{
+				return block;
+			}
+		}
+		return nullptr;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	size_t ChunkedImplicitSequence<DataType, ChunkSize>::getChunkCount() const
+	{
+		return AMS<ChunkType>::memoryManager_->getAllocatedBlockCount();
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	size_t ChunkedImplicitSequence<DataType, ChunkSize>::positionOf(const BlockType& block) const
+	{
+		const ChunkType* chunk = details::nodeOfBlock<ChunkType>(block);
+		return (chunk->slot_ + slotOffset_) * CHUNK_CAPACITY + details::indexInNode(chunk, block);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::blockAt(size_t position) const -> BlockType&
+	{
+		return table_[position / CHUNK_CAPACITY]->blocks_[position % CHUNK_CAPACITY];
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::ensureChunk(size_t position)
+	{
+		const size_t slot = position / CHUNK_CAPACITY;
+		if (table_[slot] == nullptr)
+		{
+			table_[slot] = AMS<ChunkType>::memoryManager_->allocateMemory();
+			table_[slot]->slot_ = slot - slotOffset_;
+		}
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::releaseChunkIfUnused(size_t slot)
+	{
+		if (size_ == 0 || slot < front_ / CHUNK_CAPACITY || slot > (front_ + size_ - 1) / CHUNK_CAPACITY)
+		{
+			AMS<ChunkType>::memoryManager_->releaseMemory(table_[slot]);
+			table_[slot] = nullptr;
+		}
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	void ChunkedImplicitSequence<DataType, ChunkSize>::recenterTable()
+	{
+		// The table grows only when more than half of it is used, otherwise used
+		// chunks are just moved to its middle, so a queue moving through the
+		// table does not make it grow.
+		const size_t firstSlot = front_ / CHUNK_CAPACITY;
+		const size_t usedSlots = size_ == 0 ? 0 : (front_ + size_ - 1) / CHUNK_CAPACITY - firstSlot + 1;
+		const size_t capacity = 2 * (usedSlots + 1) > tableCapacity_
+			? std::max(2 * tableCapacity_, MIN_TABLE_CAPACITY)
+			: tableCapacity_;
+		const size_t newFirstSlot = (capacity - usedSlots) / 2;
+
+		ChunkType** table = new ChunkType*[capacity]();
+		std::copy(table_ + firstSlot, table_ + firstSlot + usedSlots, table + newFirstSlot);
+
+		delete[] table_;
+		table_ = table;
+		tableCapacity_ = capacity;
+		slotOffset_ += newFirstSlot - firstSlot;
+		front_ = newFirstSlot * CHUNK_CAPACITY + front_ % CHUNK_CAPACITY;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequenceIterator::ChunkedImplicitSequenceIterator(
+		ChunkedImplicitSequence<DataType, ChunkSize>* sequence,
+		size_t index
+	) :
+		sequence_(sequence),
+		position_(index)
+	{
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequenceIterator::operator++() -> ChunkedImplicitSequenceIterator&
+	{
+		++position_;
+		return *this;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequenceIterator::operator++(int) -> ChunkedImplicitSequenceIterator
+	{
+		ChunkedImplicitSequenceIterator tmp(*this);
+		operator++();
+		return tmp;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	bool ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequenceIterator::operator==(const ChunkedImplicitSequenceIterator& other) const
+	{
+		return sequence_ == other.sequence_ && position_ == other.position_;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	bool ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequenceIterator::operator!=(const ChunkedImplicitSequenceIterator& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	DataType& ChunkedImplicitSequence<DataType, ChunkSize>::ChunkedImplicitSequenceIterator::operator*()
+	{
+		return sequence_->access(position_)->data_;
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::begin() -> IteratorType
+	{
+		return ChunkedImplicitSequenceIterator(this, 0);
+	}
+
+	template<typename DataType, size_t ChunkSize>
+	auto ChunkedImplicitSequence<DataType, ChunkSize>::end() -> IteratorType
+	{
+		return ChunkedImplicitSequenceIterator(this, size_);
+	}
+
+}
@@ -12,7 +12,6 @@ namespace ds::amt {
 		public MemoryBlock<DataType>
 	{
 		ExplicitHierarchyBlock() : parent_(nullptr) {}
-		~ExplicitHierarchyBlock() { parent_ = nullptr; }
 
 		ExplicitHierarchyBlock<DataType>* parent_;
 	};
@@ -27,6 +26,7 @@ namespace ds::amt {
 	{
 	public:
 		ExplicitHierarchy();
+		ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		ExplicitHierarchy(const ExplicitHierarchy& other);
 
 		AMT& assign(const AMT& other) override;
@@ -76,6 +76,7 @@ namespace ds::amt {
 		using BlockType = MultiWayExplicitHierarchyBlock<DataType>;
 
 		MultiWayExplicitHierarchy();
+		MultiWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other);
 		~MultiWayExplicitHierarchy();
 
@@ -115,6 +116,7 @@ namespace ds::amt {
 		using BlockType = KWayExplicitHierarchyBlock<DataType, K>;
 
 		KWayExplicitHierarchy();
+		KWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		KWayExplicitHierarchy(const KWayExplicitHierarchy& other);
 		~KWayExplicitHierarchy();
 
@@ -137,7 +139,6 @@ namespace ds::amt {
 		public ExplicitHierarchyBlock<DataType>
 	{
 		BinaryExplicitHierarchyBlock() : left_(nullptr), right_(nullptr) {}
-		~BinaryExplicitHierarchyBlock() { left_ = nullptr; right_ = nullptr; }
 
 		BinaryExplicitHierarchyBlock<DataType>* left_;
 		BinaryExplicitHierarchyBlock<DataType>* right_;
@@ -155,6 +156,7 @@ namespace ds::amt {
 		using BlockType = BinaryExplicitHierarchyBlock<DataType>;
 
 		BinaryExplicitHierarchy();
+		BinaryExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other);
 		~BinaryExplicitHierarchy();
 
@@ -196,6 +198,13 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename BlockType>
+	ExplicitHierarchy<BlockType>::ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitAMS<BlockType>(memoryManager),
+		root_(nullptr)
+	{
+	}
+
 	template<typename BlockType>
 	ExplicitHierarchy<BlockType>::ExplicitHierarchy(const ExplicitHierarchy& other) :
 		ExplicitHierarchy()
@@ -241,6 +250,12 @@ namespace ds::amt {
 	template<typename BlockType>
 	void ExplicitHierarchy<BlockType>::clear()
 	{
+		if (this->tryReleaseAllBlocks())
+		{
+			root_ = nullptr;
+			return;
+		}
+
 		Hierarchy<BlockType>::processPostOrder(root_, [&](BlockType* b)
 			{
 				AMS<BlockType>::memoryManager_->releaseMemory(b);
@@ -350,6 +365,12 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename DataType>
+	MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>(memoryManager)
+	{
+	}
+
 	template<typename DataType>
 	MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other) :
 		ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>()
@@ -418,6 +439,12 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename DataType, size_t K>
+	KWayExplicitHierarchy<DataType, K>::KWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>(memoryManager)
+	{
+	}
+
 	template<typename DataType, size_t K>
 	KWayExplicitHierarchy<DataType, K>::KWayExplicitHierarchy(const KWayExplicitHierarchy& other) :
 		ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>()
@@ -494,6 +521,12 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename DataType>
+	BinaryExplicitHierarchy<DataType>::BinaryExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>(memoryManager)
+	{
+	}
+
 	template<typename DataType>
 	BinaryExplicitHierarchy<DataType>::BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other) :
 		ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>()
@@ -527,6 +527,11 @@
 
 namespace ds::amt {
 
+    /**
+     * @brief Sequence of blocks linked by pointers.
+     * Positional access through a non-const sequence moves a finger, const access
+     * only starts from it, so concurrent const reads do not write anything.
+     */
     template<typename BlockType>
     class ExplicitSequence :
         public Sequence<BlockType>,
@@ -534,6 +539,7 @@ namespace ds::amt {
     {
     public:
         ExplicitSequence();
+        ExplicitSequence(mm::MemoryManager<BlockType>* memoryManager);
         ExplicitSequence(const ExplicitSequence& other);
         ~ExplicitSequence() override;
 
@@ -549,6 +555,11 @@ namespace ds::amt {
         BlockType* accessNext(const BlockType& block) const override;
         BlockType* accessPrevious(const BlockType& block) const override;
 
+        /**
+         * @brief Same as the const access, moves the finger to the found block.
+         */
+        BlockType* access(size_t index);
+
         BlockType& insertFirst() override;
         BlockType& insertLast() override;
         BlockType& insert(size_t index) override;
@@ -561,12 +572,24 @@ namespace ds::amt {
         void removeNext(const BlockType& block) override;
         void removePrevious(const BlockType& block) override;
 
+        BlockType* insertBlocks(size_t index, size_t count) override;
+        void removeRange(size_t index, size_t count) override;
+
     protected:
         virtual void connectBlocks(BlockType* previous, BlockType* next);
         virtual void disconnectBlock(BlockType* block);
 
+        /**
+         * @brief Remembers the block found by the last positional operation, so that
+         * sequential index loops continue from it instead of from the beginning.
+         */
+        void setFinger(BlockType* block, size_t index);
+        void resetFinger();
+
         BlockType* first_;
         BlockType* last_;
+        BlockType* finger_;
+        size_t fingerIndex_;
 
     public:
         using DataType = decltype(BlockType().data_);
@@ -603,7 +626,6 @@ namespace ds::amt {
     {
 
         SinglyLinkedSequenceBlock() : next_(nullptr) {}
-        ~SinglyLinkedSequenceBlock() { next_ = nullptr; }
 
         SinglyLinkedSequenceBlock<DataType>* next_;
     };
@@ -616,6 +638,9 @@ namespace ds::amt {
     {
     public:
         using BlockType = SinglyLinkedSequenceBlock<DataType>;
+
+        SinglyLinkedSequence();
+        SinglyLinkedSequence(mm::MemoryManager<BlockType>* memoryManager);
     };
 
     template<typename DataType>
@@ -625,6 +650,11 @@ namespace ds::amt {
     class SinglyCyclicLinkedSequence :
         public SinglyLS<DataType>
     {
+    public:
+        using BlockType = typename SinglyLS<DataType>::BlockType;
+
+        SinglyCyclicLinkedSequence();
+        SinglyCyclicLinkedSequence(mm::MemoryManager<BlockType>* memoryManager);
     };
 
     template<typename DataType>
@@ -638,7 +668,6 @@ namespace ds::amt {
     {
 
         DoublyLinkedSequenceBlock() : previous_(nullptr) {}
-        ~DoublyLinkedSequenceBlock() { previous_ = nullptr; }
 
         DoublyLinkedSequenceBlock<DataType>* previous_;
     };
@@ -653,6 +682,10 @@ namespace ds::amt {
     public:
         using BlockType = DLSBlock<DataType>;
 
+        DoublyLinkedSequence();
+        DoublyLinkedSequence(mm::MemoryManager<BlockType>* memoryManager);
+
+        using ES<DLSBlock<DataType>>::access;
         BlockType* access(size_t index) const override;
         BlockType* accessPrevious(const BlockType& block) const override;
 
@@ -670,6 +703,11 @@ namespace ds::amt {
     class DoublyCyclicLinkedSequence :
         public DoublyLS<DataType>
     {
+    public:
+        using BlockType = typename DoublyLS<DataType>::BlockType;
+
+        DoublyCyclicLinkedSequence();
+        DoublyCyclicLinkedSequence(mm::MemoryManager<BlockType>* memoryManager);
     };
 
     template<typename DataType>
@@ -679,7 +717,19 @@ namespace ds::amt {
     template<typename BlockType>
     ExplicitSequence<BlockType>::ExplicitSequence() :
         first_(nullptr),
-        last_(nullptr)
+        last_(nullptr),
+        finger_(nullptr),
+        fingerIndex_(0)
+    {
+    }
+
+    template<typename BlockType>
+    ExplicitSequence<BlockType>::ExplicitSequence(mm::MemoryManager<BlockType>* memoryManager) :
+        ExplicitAMS<BlockType>(memoryManager),
+        first_(nullptr),
+        last_(nullptr),
+        finger_(nullptr),
+        fingerIndex_(0)
     {
     }
 
@@ -716,6 +766,15 @@ namespace ds::amt {
     template<typename BlockType>
     void ExplicitSequence<BlockType>::clear()
     {
+        this->resetFinger();
+
+        if (this->tryReleaseAllBlocks())
+        {
+            first_ = nullptr;
+            last_ = nullptr;
+            return;
+        }
+
         last_ = first_;
 
         while (first_ != nullptr)
@@ -767,6 +826,11 @@ namespace ds::amt {
     template<typename BlockType>
     size_t ExplicitSequence<BlockType>::calculateIndex(BlockType& data)
     {
+        if (&data == finger_)
+        {
+            return fingerIndex_;
+        }
+
         size_t result = 0;
         BlockType* block = this->findBlockWithProperty([&](BlockType* b)
             {
@@ -792,14 +856,42 @@ namespace ds::amt {
     BlockType* ExplicitSequence<BlockType>::access(size_t index) const
     {
         BlockType* result = nullptr;
+        const size_t size = this->size();
 
-        if (index < this->size())
+        if (index < size)
         {
-            result = first_;
-            for (size_t i = 1; i <= index; i++)
+            if (index == size - 1)
             {
-                result = this->accessNext(*result);
+                result = last_;
             }
+            else
+            {
+                size_t position = 0;
+                result = first_;
+
+                if (finger_ != nullptr && fingerIndex_ <= index)
+                {
+                    position = fingerIndex_;
+                    result = finger_;
+                }
+
+                for (; position < index; ++position)
+                {
+                    result = this->accessNext(*result);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    template<typename BlockType>
+    BlockType* ExplicitSequence<BlockType>::access(size_t index)
+    {
+        BlockType* result = static_cast<const ExplicitSequence<BlockType>&>(*this).access(index);
+        if (result != nullptr)
+        {
+            this->setFinger(result, index);
         }
 
         return result;
@@ -851,11 +943,14 @@ namespace ds::amt {
     template<typename BlockType>
     BlockType& ExplicitSequence<BlockType>::insert(size_t index)
     {
-        return index == 0
+        BlockType& result = index == 0
             ? this->insertFirst()
             : index == this->size()
             ? this->insertLast()
             : this->insertAfter(*this->access(index - 1));
+
+        this->setFinger(&result, index);
+        return result;
     }
 
     template<typename BlockType>
@@ -864,6 +959,11 @@ namespace ds::amt {
         BlockType* nextBlock = this->accessNext(block);
         BlockType* newBlock = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
 
+        if (finger_ != &block && last_ != &block)
+        {
+            this->resetFinger();
+        }
+
         this->connectBlocks(&block, newBlock);
         this->connectBlocks(newBlock, nextBlock);
 
@@ -880,6 +980,15 @@ namespace ds::amt {
         BlockType* prevBlock = this->accessPrevious(block);
         BlockType* newBlock = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
 
+        if (finger_ == &block || first_ == &block)
+        {
+            ++fingerIndex_;
+        }
+        else
+        {
+            this->resetFinger();
+        }
+
         this->connectBlocks(prevBlock, newBlock);
         this->connectBlocks(newBlock, &block);
 
@@ -893,6 +1002,15 @@ namespace ds::amt {
     template<typename BlockType>
     void ExplicitSequence<BlockType>::removeFirst()
     {
+        if (finger_ == first_)
+        {
+            this->resetFinger();
+        }
+        else
+        {
+            --fingerIndex_;
+        }
+
         if (first_ == last_)
         {
             AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(first_);
@@ -909,6 +1027,11 @@ namespace ds::amt {
     template<typename BlockType>
     void ExplicitSequence<BlockType>::removeLast()
     {
+        if (finger_ == last_)
+        {
+            this->resetFinger();
+        }
+
         if (first_ == last_)
         {
             AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(last_);
@@ -946,6 +1069,11 @@ namespace ds::amt {
         }
         else
         {
+            if (finger_ != &block)
+            {
+                this->resetFinger();
+            }
+
             this->disconnectBlock(deletedBlock);
             AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(deletedBlock);
         }
@@ -961,11 +1089,117 @@ namespace ds::amt {
         }
         else
         {
+            if (finger_ == &block)
+            {
+                --fingerIndex_;
+            }
+            else
+            {
+                this->resetFinger();
+            }
+
             this->disconnectBlock(deletedBlock);
             AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(deletedBlock);
         }
     }
 
+    template<typename BlockType>
+    BlockType* ExplicitSequence<BlockType>::insertBlocks(size_t index, size_t count)
+    {
+        if (index > this->size())
+        {
+            throw std::out_of_range("Invalid index!");
+        }
+
+        if (count == 0)
+        {
+            return nullptr;
+        }
+
+        BlockType* previous = index > 0 ? this->access(index - 1) : nullptr;
+        BlockType* next = previous != nullptr ? this->accessNext(*previous) : first_;
+
+        // The new blocks are linked to each other first and spliced in with two links.
+        BlockType* chainFirst = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
+        BlockType* chainLast = chainFirst;
+        for (size_t i = 1; i < count; ++i)
+        {
+            BlockType* block = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
+            this->connectBlocks(chainLast, block);
+            chainLast = block;
+        }
+
+        this->connectBlocks(previous, chainFirst);
+        this->connectBlocks(chainLast, next);
+
+        if (previous == nullptr)
+        {
+            first_ = chainFirst;
+        }
+        if (next == nullptr)
+        {
+            last_ = chainLast;
+        }
+
+        this->setFinger(chainLast, index + count - 1);
+        return chainFirst;
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::removeRange(size_t index, size_t count)
+    {
+        if (index > this->size() || count > this->size() - index)
+        {
+            throw std::out_of_range("Invalid index!");
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        BlockType* previous = index > 0 ? this->access(index - 1) : nullptr;
+        BlockType* block = previous != nullptr ? this->accessNext(*previous) : first_;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            BlockType* next = this->accessNext(*block);
+            AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(block);
+            block = next;
+        }
+
+        if (previous != nullptr)
+        {
+            this->connectBlocks(previous, block);
+            this->setFinger(previous, index - 1);
+        }
+        else
+        {
+            first_ = block;
+            this->connectBlocks(nullptr, block);
+            this->resetFinger();
+        }
+
+        if (block == nullptr)
+        {
+            last_ = previous;
+        }
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::setFinger(BlockType* block, size_t index)
+    {
+        finger_ = block;
+        fingerIndex_ = index;
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::resetFinger()
+    {
+        finger_ = nullptr;
+        fingerIndex_ = 0;
+    }
+
     template<typename BlockType>
     void ExplicitSequence<BlockType>::connectBlocks(BlockType* previous, BlockType* next)
     {
@@ -1040,30 +1274,90 @@ namespace ds::amt {
         return ExplicitSequenceIterator(nullptr);
     }
 
+    template<typename DataType>
+    SinglyLinkedSequence<DataType>::SinglyLinkedSequence() :
+        ES<SLSBlock<DataType>>()
+    {
+    }
+
+    template<typename DataType>
+    SinglyLinkedSequence<DataType>::SinglyLinkedSequence(mm::MemoryManager<BlockType>* memoryManager) :
+        ES<SLSBlock<DataType>>(memoryManager)
+    {
+    }
+
+    template<typename DataType>
+    SinglyCyclicLinkedSequence<DataType>::SinglyCyclicLinkedSequence() :
+        SinglyLS<DataType>()
+    {
+    }
+
+    template<typename DataType>
+    SinglyCyclicLinkedSequence<DataType>::SinglyCyclicLinkedSequence(mm::MemoryManager<BlockType>* memoryManager) :
+        SinglyLS<DataType>(memoryManager)
+    {
+    }
+
+    template<typename DataType>
+    DoublyLinkedSequence<DataType>::DoublyLinkedSequence() :
+        ES<DLSBlock<DataType>>()
+    {
+    }
+
+    template<typename DataType>
+    DoublyLinkedSequence<DataType>::DoublyLinkedSequence(mm::MemoryManager<BlockType>* memoryManager) :
+        ES<DLSBlock<DataType>>(memoryManager)
+    {
+    }
+
+    template<typename DataType>
+    DoublyCyclicLinkedSequence<DataType>::DoublyCyclicLinkedSequence() :
+        DoublyLS<DataType>()
+    {
+    }
+
+    template<typename DataType>
+    DoublyCyclicLinkedSequence<DataType>::DoublyCyclicLinkedSequence(mm::MemoryManager<BlockType>* memoryManager) :
+        DoublyLS<DataType>(memoryManager)
+    {
+    }
+
     template<typename DataType>
     DLSBlock<DataType>* DoublyLinkedSequence<DataType>::access(size_t index) const
     {
         BlockType* result = nullptr;
+        const size_t size = this->size();
 
-        if (index < this->size())
+        if (index < size)
         {
-            if (index < this->size() / 2)
+            size_t position = 0;
+            result = this->first_;
+
+            if (size - 1 - index < index)
             {
-                result = this->first_;
+                position = size - 1;
+                result = this->last_;
+            }
 
-                for (size_t i = 1; i <= index; i++)
+            if (this->finger_ != nullptr)
+            {
+                const size_t distance = position < index ? index - position : position - index;
+                const size_t fingerDistance = this->fingerIndex_ < index ? index - this->fingerIndex_ : this->fingerIndex_ - index;
+                if (fingerDistance < distance)
                 {
-                    result = static_cast<BlockType*>(result->next_);
+                    position = this->fingerIndex_;
+                    result = this->finger_;
                 }
             }
-            else
+
+            for (; position < index; ++position)
             {
-                result = this->last_;
+                result = static_cast<BlockType*>(result->next_);
+            }
 
-                for (size_t i = this->size() - index; i > 1; i--)
-                {
-                    result = result->previous_;
-                }
+            for (; position > index; --position)
+            {
+                result = result->previous_;
             }
         }
 
@@ -2,7 +2,11 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/explicit_sequence.h>
+#include <libds/amt/work_stealing_pool.h>
+#include <algorithm>
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace ds::amt {
 
@@ -36,6 +40,50 @@ namespace ds::amt {
 		void processPostOrder(BlockType* node, std::function<void(BlockType*)> operation) const;
 		void processLevelOrder(BlockType* node, std::function<void(BlockType*)> operation) const;
 
+		/**
+		 * @brief Overloads accepting any callable, so the operation can be inlined.
+		 */
+		template<typename Operation>
+		void processPreOrder(const BlockType* node, Operation&& operation) const;
+		template<typename Operation>
+		void processPostOrder(BlockType* node, Operation&& operation) const;
+		template<typename Operation>
+		void processLevelOrder(BlockType* node, Operation&& operation) const;
+
+		/**
+		 * @brief Parallel traversals forking independent subtrees as tasks of @p pool.
+		 * Sons of nodes less than @p parallelDepth levels below @p node are forked unless
+		 * they are leaves or the pool is saturated, deeper subtrees are processed serially.
+		 * @p operation is called concurrently, the order of calls is only kept along paths.
+		 * Overloads without a pool use WorkStealingPool::getShared().
+		 */
+		template<typename Operation>
+		void processPreOrderParallel(const BlockType* node, Operation&& operation) const;
+		template<typename Operation>
+		void processPreOrderParallel(const BlockType* node, Operation&& operation, WorkStealingPool& pool, size_t parallelDepth = PARALLEL_DEPTH) const;
+		template<typename Operation>
+		void processPostOrderParallel(BlockType* node, Operation&& operation) const;
+		template<typename Operation>
+		void processPostOrderParallel(BlockType* node, Operation&& operation, WorkStealingPool& pool, size_t parallelDepth = PARALLEL_DEPTH) const;
+
+		/**
+		 * @brief Returns results of @p map for all nodes of the subtree of non-null @p node
+		 * joined by @p combine in pre-order. @p combine has to be associative.
+		 */
+		template<typename Map, typename Combine>
+		auto parallelReduce(const BlockType* node, Map&& map, Combine&& combine) const -> decltype(map(node));
+		template<typename Map, typename Combine>
+		auto parallelReduce(const BlockType* node, Map&& map, Combine&& combine, WorkStealingPool& pool, size_t parallelDepth = PARALLEL_DEPTH) const -> decltype(map(node));
+
+		static const size_t PARALLEL_DEPTH = 16;
+
+	private:
+		template<typename SonOperation>
+		void forkSons(const BlockType& node, WorkStealingPool& pool, SonOperation&& sonOperation) const;
+
+		template<typename Map, typename Combine>
+		auto reduce(const BlockType* node, Map& map, Combine& combine) const -> decltype(map(node));
+
 	protected:
 		using DataType = decltype(BlockType().data_);
 
@@ -44,45 +92,30 @@ namespace ds::amt {
 		protected:
 			struct DepthFirstIteratorPosition
 			{
-				DepthFirstIteratorPosition(BlockType* currentNode, DepthFirstIteratorPosition* previousPosition) :
+				DepthFirstIteratorPosition() :
+					DepthFirstIteratorPosition(nullptr)
+				{}
+
+				explicit DepthFirstIteratorPosition(BlockType* currentNode) :
 					currentNode_(currentNode),
 					currentSon_(nullptr),
 					currentSonOrder_(INVALID_INDEX),
 					visitedSonCount_(0),
-					currentNodeProcessed_(false),
-					previousPosition_(previousPosition)
-				{}
-
-				DepthFirstIteratorPosition(const DepthFirstIteratorPosition& other) :
-					currentNode_(other.currentNode_),
-					currentSon_(other.currentSon_),
-					currentSonOrder_(other.currentSonOrder_),
-					visitedSonCount_(other.visitedSonCount_),
-					currentNodeProcessed_(other.currentNodeProcessed_),
-					previousPosition_(other.previousPosition_)
+					currentNodeProcessed_(false)
 				{}
 
-				~DepthFirstIteratorPosition() {
-					currentNode_ = nullptr;
-					currentSon_ = nullptr;
-					currentSonOrder_ = 0;
-					visitedSonCount_ = 0;
-					currentNodeProcessed_ = false;
-					previousPosition_ = nullptr;
-				}
-
 				BlockType* currentNode_;
 				BlockType* currentSon_;
 				size_t currentSonOrder_;
 				size_t visitedSonCount_;
 				bool currentNodeProcessed_;
-				DepthFirstIteratorPosition* previousPosition_;
 			};
 
 		public:
 			DepthFirstIterator(Hierarchy<BlockType>* hierarchy);
 			DepthFirstIterator(const DepthFirstIterator& other);
 			~DepthFirstIterator();
+			DepthFirstIterator& operator=(const DepthFirstIterator& other);
 			bool operator==(const DepthFirstIterator& other) const;
 			bool operator!=(const DepthFirstIterator& other) const;
 			DataType& operator*();
@@ -94,6 +127,21 @@ namespace ds::amt {
 
 			Hierarchy<BlockType>* hierarchy_;
 			DepthFirstIteratorPosition* currentPosition_;
+
+		private:
+			void reservePositions(size_t count);
+
+			/**
+			 * @brief Positions on the path to the current node form a stack. Paths up to
+			 * INLINE_DEPTH nodes are stored in the iterator, longer ones in a heap buffer
+			 * that grows by doubling and is reused until the iterator is destroyed.
+			 */
+			static constexpr size_t INLINE_DEPTH = 16;
+
+			DepthFirstIteratorPosition inlinePositions_[INLINE_DEPTH];
+			DepthFirstIteratorPosition* positions_;
+			size_t capacity_;
+			size_t depth_;
 		};
 
 	public:
@@ -166,6 +214,8 @@ namespace ds::amt {
 		void removeRightSon(BlockType& parent);
 
 		void processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const;
+		template<typename Operation>
+		void processInOrder(const BlockType* node, Operation&& operation) const;
 
 		//----------
 
@@ -190,6 +240,55 @@ namespace ds::amt {
 
 	//----------
 
+	/**
+	 * @brief Calls operations of a hierarchy of type HierarchyType without virtual dispatch.
+	 * Calls are qualified by HierarchyType, so they are bound at compile time and can be inlined.
+	 * The dynamic type of the wrapped hierarchy has to be exactly HierarchyType.
+	 */
+	template<typename HierarchyType>
+	class StaticHierarchy
+	{
+	public:
+		using BlockType = typename HierarchyType::BlockType;
+		using IteratorType = typename HierarchyType::IteratorType;
+
+		explicit StaticHierarchy(HierarchyType* hierarchy);
+
+		HierarchyType* get() const;
+
+		size_t level(const BlockType& node) const;
+		size_t degree(const BlockType& node) const;
+		size_t nodeCount() const;
+		size_t nodeCount(const BlockType& node) const;
+
+		BlockType* accessRoot() const;
+		BlockType* accessParent(const BlockType& node) const;
+		BlockType* accessSon(const BlockType& node, size_t sonOrder) const;
+
+		bool isRoot(const BlockType& node) const;
+		bool isNthSon(const BlockType& node, size_t sonOrder) const;
+		bool isLeaf(const BlockType& node) const;
+		bool hasNthSon(const BlockType& node, size_t sonOrder) const;
+
+		BlockType& emplaceRoot() const;
+		void changeRoot(BlockType* newRoot) const;
+
+		BlockType& emplaceSon(BlockType& parent, size_t sonOrder) const;
+		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) const;
+		void removeSon(BlockType& parent, size_t sonOrder) const;
+
+		template<typename Operation>
+		void processPreOrder(const BlockType* node, Operation&& operation) const;
+
+		IteratorType begin() const;
+		IteratorType end() const;
+
+	private:
+		HierarchyType* hierarchy_;
+	};
+
+	//----------
+
 	template<typename BlockType>
 	size_t Hierarchy<BlockType>::level(const BlockType& node) const
 	{
@@ -247,6 +346,31 @@ namespace ds::amt {
 
 	template<typename BlockType>
 	void Hierarchy<BlockType>::processPreOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
+	{
+		this->processPreOrder(node, [&operation](const BlockType* block) { operation(block); });
+	}
+
+	template<typename BlockType>
+	void Hierarchy<BlockType>::processPostOrder(BlockType* node, std::function<void(BlockType*)> operation) const
+	{
+		this->processPostOrder(node, [&operation](BlockType* block) { operation(block); });
+	}
+
+	template<typename BlockType>
+	void Hierarchy<BlockType>::processLevelOrder(BlockType* node, std::function<void(BlockType*)> operation) const
+	{
+		this->processLevelOrder(node, [&operation](BlockType* block) { operation(block); });
+	}
+
+	template<typename BlockType>
+	void BinaryHierarchy<BlockType>::processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
+	{
+		this->processInOrder(node, [&operation](const BlockType* block) { operation(block); });
+	}
+
+	template<typename BlockType>
+	template<typename Operation>
+	void Hierarchy<BlockType>::processPreOrder(const BlockType* node, Operation&& operation) const
 	{
 		if (node != nullptr)
 		{
@@ -270,7 +394,8 @@ namespace ds::amt {
 	}
 
 	template<typename BlockType>
-	void Hierarchy<BlockType>::processPostOrder(BlockType* node, std::function<void(BlockType*)> operation) const
+	template<typename Operation>
+	void Hierarchy<BlockType>::processPostOrder(BlockType* node, Operation&& operation) const
 	{
 		if (node != nullptr)
 		{
@@ -293,7 +418,8 @@ namespace ds::amt {
 	}
 
 	template<typename BlockType>
-	void Hierarchy<BlockType>::processLevelOrder(BlockType* node, std::function<void(BlockType*)> operation) const
+	template<typename Operation>
+	void Hierarchy<BlockType>::processLevelOrder(BlockType* node, Operation&& operation) const
 	{
 		if (node != nullptr)
 		{
@@ -325,7 +451,171 @@ namespace ds::amt {
 	}
 
 	template<typename BlockType>
-	void BinaryHierarchy<BlockType>::processInOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
+	template<typename Operation>
+	void Hierarchy<BlockType>::processPreOrderParallel(const BlockType* node, Operation&& operation) const
+	{
+		this->processPreOrderParallel(node, operation, WorkStealingPool::getShared());
+	}
+
+	template<typename BlockType>
+	template<typename Operation>
+	void Hierarchy<BlockType>::processPreOrderParallel(const BlockType* node, Operation&& operation, WorkStealingPool& pool, size_t parallelDepth) const
+	{
+		if (node == nullptr)
+		{
+			return;
+		}
+
+		if (parallelDepth == 0 || pool.isSaturated())
+		{
+			this->processPreOrder(node, operation);
+			return;
+		}
+
+		operation(node);
+		this->forkSons(*node, pool, [&](BlockType* son, size_t)
+			{
+				this->processPreOrderParallel(son, operation, pool, parallelDepth - 1);
+			});
+	}
+
+	template<typename BlockType>
+	template<typename Operation>
+	void Hierarchy<BlockType>::processPostOrderParallel(BlockType* node, Operation&& operation) const
+	{
+		this->processPostOrderParallel(node, operation, WorkStealingPool::getShared());
+	}
+
+	template<typename BlockType>
+	template<typename Operation>
+	void Hierarchy<BlockType>::processPostOrderParallel(BlockType* node, Operation&& operation, WorkStealingPool& pool, size_t parallelDepth) const
+	{
+		if (node == nullptr)
+		{
+			return;
+		}
+
+		if (parallelDepth == 0 || pool.isSaturated())
+		{
+			this->processPostOrder(node, operation);
+			return;
+		}
+
+		this->forkSons(*node, pool, [&](BlockType* son, size_t)
+			{
+				this->processPostOrderParallel(son, operation, pool, parallelDepth - 1);
+			});
+		operation(node);
+	}
+
+	template<typename BlockType>
+	template<typename Map, typename Combine>
+	auto Hierarchy<BlockType>::parallelReduce(const BlockType* node, Map&& map, Combine&& combine) const -> decltype(map(node))
+	{
+		return this->parallelReduce(node, map, combine, WorkStealingPool::getShared());
+	}
+
+	template<typename BlockType>
+	template<typename Map, typename Combine>
+	auto Hierarchy<BlockType>::parallelReduce(const BlockType* node, Map&& map, Combine&& combine, WorkStealingPool& pool, size_t parallelDepth) const -> decltype(map(node))
+	{
+		using ResultType = decltype(map(node));
+
+		if (parallelDepth == 0 || pool.isSaturated())
+		{
+			return this->reduce(node, map, combine);
+		}
+
+		// Results of sons are kept in order, so combine does not have to be commutative.
+		ResultType result = map(node);
+		std::vector<std::optional<ResultType>> sonResults(this->degree(*node));
+		this->forkSons(*node, pool, [&](BlockType* son, size_t sonIndex)
+			{
+				sonResults[sonIndex].emplace(this->parallelReduce(son, map, combine, pool, parallelDepth - 1));
+			});
+		for (std::optional<ResultType>& sonResult : sonResults)
+		{
+			result = combine(std::move(result), std::move(*sonResult));
+		}
+		return result;
+	}
+
+	template<typename BlockType>
+	template<typename SonOperation>
+	void Hierarchy<BlockType>::forkSons(const BlockType& node, WorkStealingPool& pool, SonOperation&& sonOperation) const
+	{
+		WorkStealingPool::TaskGroup group;
+		bool forked = false;
+		try
+		{
+			size_t deg = this->degree(node);
+			size_t sonOrder = 0;
+			size_t proccessedSons = 0;
+			while (proccessedSons < deg)
+			{
+				BlockType* son = this->accessSon(node, sonOrder);
+				if (son != nullptr)
+				{
+					if (!this->isLeaf(*son) && !pool.isSaturated())
+					{
+						pool.fork(group, [&sonOperation, son, proccessedSons]() { sonOperation(son, proccessedSons); });
+						forked = true;
+					}
+					else
+					{
+						sonOperation(son, proccessedSons);
+					}
+					++proccessedSons;
+				}
+				++sonOrder;
+			}
+		}
+		catch (...)
+		{
+			// Forked tasks refer to this frame, so they have to finish before it is left.
+			if (forked)
+			{
+				try
+				{
+					pool.wait(group);
+				}
+				catch (...)
+				{
+				}
+			}
+			throw;
+		}
+
+		if (forked)
+		{
+			pool.wait(group);
+		}
+	}
+
+	template<typename BlockType>
+	template<typename Map, typename Combine>
+	auto Hierarchy<BlockType>::reduce(const BlockType* node, Map& map, Combine& combine) const -> decltype(map(node))
+	{
+		decltype(map(node)) result = map(node);
+		size_t deg = this->degree(*node);
+		size_t sonOrder = 0;
+		size_t proccessedSons = 0;
+		while (proccessedSons < deg)
+		{
+			BlockType* son = this->accessSon(*node, sonOrder);
+			if (son != nullptr)
+			{
+				result = combine(std::move(result), this->reduce(son, map, combine));
+				++proccessedSons;
+			}
+			++sonOrder;
+		}
+		return result;
+	}
+
+	template<typename BlockType>
+	template<typename Operation>
+	void BinaryHierarchy<BlockType>::processInOrder(const BlockType* node, Operation&& operation) const
 	{
 		if (node != nullptr)
 		{
@@ -338,7 +628,10 @@ namespace ds::amt {
 	template<typename BlockType>
 	Hierarchy<BlockType>::DepthFirstIterator::DepthFirstIterator(Hierarchy<BlockType>* hierarchy) :
 		hierarchy_(hierarchy),
-		currentPosition_(nullptr)
+		currentPosition_(nullptr),
+		positions_(inlinePositions_),
+		capacity_(INLINE_DEPTH),
+		depth_(0)
 	{
 	}
 
@@ -346,34 +639,35 @@ namespace ds::amt {
 	Hierarchy<BlockType>::DepthFirstIterator::DepthFirstIterator(const DepthFirstIterator& other) :
 		DepthFirstIterator(other.hierarchy_)
 	{
-		DepthFirstIteratorPosition* myPosition = nullptr;
-		for (DepthFirstIteratorPosition* otherPosition = other.currentPosition_;
-			otherPosition != nullptr;
-			otherPosition = otherPosition->previousPosition_)
-		{
-			if (currentPosition_ == nullptr)
-			{
-				currentPosition_ = new DepthFirstIteratorPosition(*otherPosition);
-				myPosition = currentPosition_;
-			}
-			else
-			{
-				myPosition->previousPosition_ = new DepthFirstIteratorPosition(*otherPosition);
-				myPosition = myPosition->previousPosition_;
-			}
-		}
+		*this = other;
 	}
 
 	template<typename BlockType>
 	Hierarchy<BlockType>::DepthFirstIterator::~DepthFirstIterator()
 	{
-		while (currentPosition_ != nullptr)
+		if (positions_ != inlinePositions_)
 		{
-			removePosition();
+			delete[] positions_;
 		}
 
 		hierarchy_ = nullptr;
 		currentPosition_ = nullptr;
+		positions_ = nullptr;
+	}
+
+	template<typename BlockType>
+	auto Hierarchy<BlockType>::DepthFirstIterator::operator=(const DepthFirstIterator& other) -> DepthFirstIterator&
+	{
+		if (this != &other)
+		{
+			hierarchy_ = other.hierarchy_;
+			this->reservePositions(other.depth_);
+			std::copy(other.positions_, other.positions_ + other.depth_, positions_);
+			depth_ = other.depth_;
+			currentPosition_ = depth_ > 0 ? positions_ + depth_ - 1 : nullptr;
+		}
+
+		return *this;
 	}
 
 	template<typename BlockType>
@@ -386,10 +680,7 @@ namespace ds::amt {
 
 		if (myPosition != nullptr && otherPosition != nullptr)
 		{
-			if (myPosition->currentNode_ != otherPosition->currentNode_ || myPosition->currentSonOrder_ != otherPosition->currentSonOrder_)
-			{
-				return false;
-			}
+			return myPosition->currentNode_ == otherPosition->currentNode_ && myPosition->currentSonOrder_ == otherPosition->currentSonOrder_;
 		}
 
 		return myPosition == nullptr && otherPosition == nullptr;
@@ -404,22 +695,44 @@ namespace ds::amt {
 	template<typename BlockType>
 	auto Hierarchy<BlockType>::DepthFirstIterator::operator*() -> DataType&
 	{
-		currentPosition_->currentNodeProcessed_ = true;
 		return currentPosition_->currentNode_->data_;
 	}
 
 	template<typename BlockType>
 	void Hierarchy<BlockType>::DepthFirstIterator::savePosition(BlockType* currentNode)
 	{
-		currentPosition_ = new DepthFirstIteratorPosition(currentNode, currentPosition_);
+		this->reservePositions(depth_ + 1);
+		positions_[depth_] = DepthFirstIteratorPosition(currentNode);
+		currentPosition_ = positions_ + depth_;
+		++depth_;
 	}
 
 	template<typename BlockType>
 	void Hierarchy<BlockType>::DepthFirstIterator::removePosition()
 	{
-		DepthFirstIteratorPosition* positionToRemove = currentPosition_;
-		currentPosition_ = currentPosition_->previousPosition_;
-		delete positionToRemove;
+		--depth_;
+		currentPosition_ = depth_ > 0 ? positions_ + depth_ - 1 : nullptr;
+	}
+
+	template<typename BlockType>
+	void Hierarchy<BlockType>::DepthFirstIterator::reservePositions(size_t count)
+	{
+		if (count <= capacity_)
+		{
+			return;
+		}
+
+		const size_t newCapacity = (std::max)(count, 2 * capacity_);
+		DepthFirstIteratorPosition* newPositions = new DepthFirstIteratorPosition[newCapacity];
+		std::copy(positions_, positions_ + depth_, newPositions);
+
+		if (positions_ != inlinePositions_)
+		{
+			delete[] positions_;
+		}
+
+		positions_ = newPositions;
+		capacity_ = newCapacity;
 	}
 
 	template<typename BlockType>
@@ -464,17 +777,14 @@ namespace ds::amt {
 	template<typename BlockType>
 	typename Hierarchy<BlockType>::PreOrderHierarchyIterator& Hierarchy<BlockType>::PreOrderHierarchyIterator::operator++()
 	{
-		if (this->tryFindNextSonInCurrentPosition())
+		while (this->currentPosition_ != nullptr)
 		{
-			this->savePosition(this->currentPosition_->currentSon_);
-		}
-		else
-		{
-			this->removePosition();
-			if (this->currentPosition_ != nullptr)
+			if (this->tryFindNextSonInCurrentPosition())
 			{
-				++(*this);
+				this->savePosition(this->currentPosition_->currentSon_);
+				break;
 			}
+			this->removePosition();
 		}
 		return *this;
 	}
@@ -514,6 +824,11 @@ namespace ds::amt {
 					++(*this);
 				}
 			}
+			else
+			{
+				// all sons are done, the iterator stops on the node and leaves it on the next increment
+				this->currentPosition_->currentNodeProcessed_ = true;
+			}
 		}
 		return *this;
 	}
@@ -653,6 +968,11 @@ namespace ds::amt {
 				this->savePosition(this->currentPosition_->currentSon_);
 				++(*this);
 			}
+			else
+			{
+				// the left subtree is done, the iterator stops on the node and goes right on the next increment
+				this->currentPosition_->currentNodeProcessed_ = true;
+			}
 		}
 		else
 		{
@@ -716,4 +1036,163 @@ namespace ds::amt {
 	{
 		return InOrderHierarchyIterator(this, nullptr);
 	}
+	template<typename HierarchyType>
+	StaticHierarchy<HierarchyType>::StaticHierarchy(HierarchyType* hierarchy) :
+		hierarchy_(hierarchy)
+	{
+	}
+
+	template<typename HierarchyType>
+	HierarchyType* StaticHierarchy<HierarchyType>::get() const
+	{
+		return hierarchy_;
+	}
+
+	template<typename HierarchyType>
+	size_t StaticHierarchy<HierarchyType>::level(const BlockType& node) const
+	{
+		size_t level = 0;
+		BlockType* parent = this->accessParent(node);
+		while (parent != nullptr)
+		{
+			level++;
+			parent = this->accessParent(*parent);
+		}
+
+		return level;
+	}
+
+	template<typename HierarchyType>
+	size_t StaticHierarchy<HierarchyType>::degree(const BlockType& node) const
+	{
+		return hierarchy_->HierarchyType::degree(node);
+	}
+
+	template<typename HierarchyType>
+	size_t StaticHierarchy<HierarchyType>::nodeCount() const
+	{
+		return hierarchy_->HierarchyType::size();
+	}
+
+	template<typename HierarchyType>
+	size_t StaticHierarchy<HierarchyType>::nodeCount(const BlockType& node) const
+	{
+		if (&node == this->accessRoot())
+		{
+			return this->nodeCount();
+		}
+
+		size_t result = 0;
+		this->processPreOrder(&node, [&result](const BlockType*) { result++; });
+		return result;
+	}
+
+	template<typename HierarchyType>
+	auto StaticHierarchy<HierarchyType>::accessRoot() const -> BlockType*
+	{
+		return hierarchy_->HierarchyType::accessRoot();
+	}
+
+	template<typename HierarchyType>
+	auto StaticHierarchy<HierarchyType>::accessParent(const BlockType& node) const -> BlockType*
+	{
+		return hierarchy_->HierarchyType::accessParent(node);
+	}
+
+	template<typename HierarchyType>
+	auto StaticHierarchy<HierarchyType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+	{
+		return hierarchy_->HierarchyType::accessSon(node, sonOrder);
+	}
+
+	template<typename HierarchyType>
+	bool StaticHierarchy<HierarchyType>::isRoot(const BlockType& node) const
+	{
+		return this->accessParent(node) == nullptr;
+	}
+
+	template<typename HierarchyType>
+	bool StaticHierarchy<HierarchyType>::isNthSon(const BlockType& node, size_t sonOrder) const
+	{
+		BlockType* father = this->accessParent(node);
+		return father != nullptr && this->accessSon(*father, sonOrder) == &node;
+	}
+
+	template<typename HierarchyType>
+	bool StaticHierarchy<HierarchyType>::isLeaf(const BlockType& node) const
+	{
+		return this->degree(node) == 0;
+	}
+
+	template<typename HierarchyType>
+	bool StaticHierarchy<HierarchyType>::hasNthSon(const BlockType& node, size_t sonOrder) const
+	{
+		return this->accessSon(node, sonOrder) != nullptr;
+	}
+
+	template<typename HierarchyType>
+	auto StaticHierarchy<HierarchyType>::emplaceRoot() const -> BlockType&
+	{
+		return hierarchy_->HierarchyType::emplaceRoot();
+	}
+
+	template<typename HierarchyType>
+	void StaticHierarchy<HierarchyType>::changeRoot(BlockType* newRoot) const
+	{
+		hierarchy_->HierarchyType::changeRoot(newRoot);
+	}
+
+	template<typename HierarchyType>
+	auto StaticHierarchy<HierarchyType>::emplaceSon(BlockType& parent, size_t sonOrder) const -> BlockType&
+	{
+		return hierarchy_->HierarchyType::emplaceSon(parent, sonOrder);
+	}
+
+	template<typename HierarchyType>
+	void StaticHierarchy<HierarchyType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) const
+	{
+		hierarchy_->HierarchyType::changeSon(parent, sonOrder, newSon);
+	}
+
+	template<typename HierarchyType>
+	void StaticHierarchy<HierarchyType>::removeSon(BlockType& parent, size_t sonOrder) const
+	{
+		hierarchy_->HierarchyType::removeSon(parent, sonOrder);
+	}
+
+	template<typename HierarchyType>
+	template<typename Operation>
+	void StaticHierarchy<HierarchyType>::processPreOrder(const BlockType* node, Operation&& operation) const
+	{
+		if (node != nullptr)
+		{
+			operation(node);
+
+			size_t deg = this->degree(*node);
+			size_t sonOrder = 0;
+			size_t proccessedSons = 0;
+			while (proccessedSons < deg)
+			{
+				BlockType* son = this->accessSon(*node, sonOrder);
+				if (son != nullptr)
+				{
+					this->processPreOrder(son, operation);
+					++proccessedSons;
+				}
+				++sonOrder;
+			}
+		}
+	}
+
+	template<typename HierarchyType>
+	auto StaticHierarchy<HierarchyType>::begin() const -> IteratorType
+	{
+		return hierarchy_->begin();
+	}
+
+	template<typename HierarchyType>
+	auto StaticHierarchy<HierarchyType>::end() const -> IteratorType
+	{
+		return hierarchy_->end();
+	}
 }
@@ -226,23 +226,255 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/hierarchy.h>
-#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace ds::amt {
 
-	template<typename DataType, size_t K>
+	namespace details {
+
+		/**
+		 * @brief Returns floor(log2(n)) for @p n > 0.
+		 */
+		inline size_t floorLog2(size_t n)
+		{
+#if defined(_MSC_VER) && (defined(_WIN64) || defined(_M_X64) || defined(_M_ARM64))
+			unsigned long result;
+			_BitScanReverse64(&result, n);
+			return result;
+#elif defined(__GNUG__)
+			return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(n);
+#else
+			size_t result = 0;
+			while (n >>= 1)
+			{
+				++result;
+			}
+			return result;
+#endif
+		}
+
+		/**
+		 * @brief Indices of the first node of every level of a complete K-way hierarchy
+		 * stored in an array. Levels whose first index does not fit into size_t are omitted.
+		 * Since levels grow at least K >= 3 times, indices i with the same floor(log2(i + 1))
+		 * span at most two levels, so bitLengthLevels_ gives the level up to one comparison.
+		 */
+		template<size_t K>
+		struct LevelStartTable
+		{
+			constexpr LevelStartTable()
+			{
+				size_t start = 0;
+				while (true)
+				{
+					starts_[count_++] = start;
+					if (start > (std::numeric_limits<size_t>::max() - 1) / K)
+					{
+						break;
+					}
+					start = start * K + 1;
+				}
+
+				size_t level = 0;
+				for (size_t bits = 0; bits < std::numeric_limits<size_t>::digits; ++bits)
+				{
+					const size_t index = (static_cast<size_t>(1) << bits) - 1;
+					while (level + 1 < count_ && starts_[level + 1] <= index)
+					{
+						++level;
+					}
+					bitLengthLevels_[bits] = level;
+				}
+			}
+
+			size_t starts_[std::numeric_limits<size_t>::digits + 1] {};
+			size_t bitLengthLevels_[std::numeric_limits<size_t>::digits] {};
+			size_t count_ = 0;
+		};
+
+	}
+
+	/**
+	 * @brief Layout storing nodes in level order, the son of node i is at K * i + sonOrder + 1.
+	 */
+	struct LevelOrderLayout
+	{
+		static constexpr bool IS_LEVEL_ORDER = true;
+		static constexpr bool DEPENDS_ON_HEIGHT = false;
+
+		static size_t slotOf(size_t index, size_t /*height*/) { return index; }
+		static size_t indexOf(size_t slot, size_t /*height*/) { return slot; }
+		static size_t slotCount(size_t nodeCount, size_t /*height*/) { return nodeCount; }
+	};
+
+	/**
+	 * @brief Layout of a binary hierarchy cut into complete subtrees of @p BlockHeight levels,
+	 * each stored contiguously in level order. Blocks follow each other in level order of their roots,
+	 * so a root to leaf path touches one block per BlockHeight levels.
+	 * The layout does not depend on the height, unused slots of the last blocks stay empty.
+	 */
+	template<size_t BlockHeight>
+	struct BlockedLayout
+	{
+		static_assert(BlockHeight > 0 && BlockHeight < 16, "Block height has to be between 1 and 15.");
+
+		static constexpr bool IS_LEVEL_ORDER = false;
+		static constexpr bool DEPENDS_ON_HEIGHT = false;
+		static constexpr size_t BLOCK_SIZE = (static_cast<size_t>(1) << BlockHeight) - 1;
+
+		static size_t slotOf(size_t index, size_t /*height*/)
+		{
+			const size_t level = details::floorLog2(index + 1);
+			const size_t depth = level % BlockHeight;
+			const size_t root = ((index + 1) >> depth) - 1;
+			return blockOf(root, level - depth) * BLOCK_SIZE + (index + 1) - ((root + 1) << depth) + (static_cast<size_t>(1) << depth) - 1;
+		}
+
+		static size_t indexOf(size_t slot, size_t /*height*/)
+		{
+			const size_t block = slot / BLOCK_SIZE;
+			const size_t local = slot % BLOCK_SIZE;
+			const size_t depth = details::floorLog2(local + 1);
+			// Blocks with roots on level q * BlockHeight start at (2^(q * BlockHeight) - 1) / BLOCK_SIZE.
+			const size_t rootLevel = details::floorLog2(block * BLOCK_SIZE + 1) / BlockHeight * BlockHeight;
+			const size_t firstBlock = ((static_cast<size_t>(1) << rootLevel) - 1) / BLOCK_SIZE;
+			const size_t root = (static_cast<size_t>(1) << rootLevel) - 1 + block - firstBlock;
+			return ((root + 1) << depth) + local + 1 - (static_cast<size_t>(1) << depth) - 1;
+		}
+
+		static size_t slotCount(size_t nodeCount, size_t /*height*/)
+		{
+			if (nodeCount == 0)
+			{
+				return 0;
+			}
+
+			// The last used block is the one of the last node if it is a root of a block,
+			// otherwise the level of roots above it is full and its last block is used.
+			const size_t last = nodeCount - 1;
+			const size_t level = details::floorLog2(last + 1);
+			const size_t depth = level % BlockHeight;
+			const size_t rootLevel = level - depth;
+			const size_t lastRoot = depth == 0 ? last : (static_cast<size_t>(2) << rootLevel) - 2;
+			return (blockOf(lastRoot, rootLevel) + 1) * BLOCK_SIZE;
+		}
+
+	private:
+		static size_t blockOf(size_t root, size_t rootLevel)
+		{
+			const size_t levelStart = (static_cast<size_t>(1) << rootLevel) - 1;
+			return levelStart / BLOCK_SIZE + root - levelStart;
+		}
+	};
+
+	/**
+	 * @brief Cache oblivious layout of a complete binary hierarchy with given height.
+	 * The top half of levels is stored first, followed by the subtrees hanging from it,
+	 * every part recursively in the same layout. A root to leaf path touches O(log_B n) blocks
+	 * of any size B. Adding a level changes positions of all nodes.
+	 */
+	struct VanEmdeBoasLayout
+	{
+		static constexpr bool IS_LEVEL_ORDER = false;
+		static constexpr bool DEPENDS_ON_HEIGHT = true;
+
+		static size_t slotOf(size_t index, size_t height)
+		{
+			size_t slot = 0;
+			while (height > 1)
+			{
+				const size_t topHeight = height / 2;
+				const size_t bottomHeight = height - topHeight;
+				const size_t level = details::floorLog2(index + 1);
+				if (level < topHeight)
+				{
+					height = topHeight;
+				}
+				else
+				{
+					const size_t depth = level - topHeight;
+					const size_t root = ((index + 1) >> depth) - 1;
+					const size_t topSize = (static_cast<size_t>(1) << topHeight) - 1;
+					slot += topSize + (root - topSize) * ((static_cast<size_t>(1) << bottomHeight) - 1);
+					index = (static_cast<size_t>(1) << depth) + (index + 1) - ((root + 1) << depth) - 1;
+					height = bottomHeight;
+				}
+			}
+			return slot;
+		}
+
+		static size_t indexOf(size_t slot, size_t height)
+		{
+			if (height <= 1)
+			{
+				return 0;
+			}
+
+			const size_t topHeight = height / 2;
+			const size_t bottomHeight = height - topHeight;
+			const size_t topSize = (static_cast<size_t>(1) << topHeight) - 1;
+			if (slot < topSize)
+			{
+				return indexOf(slot, topHeight);
+			}
+
+			const size_t bottomSize = (static_cast<size_t>(1) << bottomHeight) - 1;
+			const size_t root = topSize + (slot - topSize) / bottomSize;
+			const size_t local = indexOf((slot - topSize) % bottomSize, bottomHeight);
+			const size_t depth = details::floorLog2(local + 1);
+			return ((root + 1) << depth) + local + 1 - (static_cast<size_t>(1) << depth) - 1;
+		}
+
+		static size_t slotCount(size_t nodeCount, size_t height)
+		{
+			return nodeCount == 0 ? 0 : (static_cast<size_t>(1) << height) - 1;
+		}
+	};
+
+	template<typename DataType, size_t K, typename Layout = LevelOrderLayout>
 	class ImplicitHierarchy :
 		virtual public KWayHierarchy<MemoryBlock<DataType>, K>,
 		public ImplicitAMS<DataType>
 	{
+		static_assert(K > 1, "Implicit hierarchy needs at least two sons per node.");
+		static_assert(Layout::IS_LEVEL_ORDER || K == 2, "Only binary implicit hierarchies support other layouts.");
+
 	public:
 		ImplicitHierarchy();
 		~ImplicitHierarchy() override;
 
+		size_t size() const override;
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		bool equals(const AMT& other) override;
+
 		size_t level(const MemoryBlock<DataType>& node) const override;
 		size_t level(size_t index) const;
 		size_t degree(const MemoryBlock<DataType>& node) const override;
 		size_t degree(size_t index) const;
+
+		/**
+		 * @brief Writes levels of @p count nodes starting at @p firstIndex to @p out.
+		 * @return Iterator past the last written level.
+		 */
+		template<class OutputIterator>
+		OutputIterator levels(size_t firstIndex, size_t count, OutputIterator out) const; // throw(std::out_of_range)
+
+		/**
+		 * @brief Writes degrees of @p count nodes starting at @p firstIndex to @p out.
+		 * @return Iterator past the last written degree.
+		 */
+		template<class OutputIterator>
+		OutputIterator degrees(size_t firstIndex, size_t count, OutputIterator out) const; // throw(std::out_of_range)
+
 		// Overload with one parameter hides overload with no parameter. We need to explicitly 'include' it.
 		using Hierarchy<MemoryBlock<DataType>>::nodeCount;
 		size_t nodeCount(const MemoryBlock<DataType>& node) const override;
@@ -252,6 +484,12 @@ namespace ds::amt {
 		MemoryBlock<DataType>* accessSon(const MemoryBlock<DataType>& node, size_t sonOrder) const override;
 		MemoryBlock<DataType>* accessLastLeaf() const;
 
+		/**
+		 * @brief Returns node with level order @p index, or nullptr if there is no such node.
+		 * Descending by indexOfSon and access avoids mapping blocks back to indices.
+		 */
+		MemoryBlock<DataType>* access(size_t index) const;
+
 		MemoryBlock<DataType>& emplaceRoot() override; // throw(unavailable_function_call)
 		void changeRoot(MemoryBlock<DataType>* newRoot) override; // throw(unavailable_function_call)
 
@@ -266,183 +504,410 @@ namespace ds::amt {
 		size_t indexOfParent(size_t index) const;
 		size_t indexOfSon(const MemoryBlock<DataType>& node, size_t sonOrder) const;
 		size_t indexOfSon(size_t indexOfParent, size_t sonOrder) const;
+
+	private:
+		static constexpr bool IS_POWER_OF_TWO = (K & (K - 1)) == 0;
+		static constexpr details::LevelStartTable<K> LEVEL_STARTS {};
+
+		void checkRange(size_t firstIndex, size_t count) const;
+
+		size_t indexOfBlock(const MemoryBlock<DataType>& node) const;
+		MemoryBlock<DataType>& blockAt(size_t index) const;
+		void changeHeight(size_t height);
+
+	private:
+		/**
+		 * @brief Number of nodes, used only if blocks are not stored in level order.
+		 */
+		size_t nodeCount_;
+
+		/**
+		 * @brief Number of levels the layout is computed for, used only if it depends on it.
+		 */
+		size_t height_;
 	};
 
-	template<typename DataType, size_t K>
-	using IH = ImplicitHierarchy<DataType, K>;
+	template<typename DataType, size_t K, typename Layout = LevelOrderLayout>
+	using IH = ImplicitHierarchy<DataType, K, Layout>;
 
 	//----------
 
-	template<typename DataType>
+	template<typename DataType, typename Layout = LevelOrderLayout>
 	class BinaryImplicitHierarchy :
 		public BinaryHierarchy<MemoryBlock<DataType>>,
-		public ImplicitHierarchy<DataType, 2>
+		public ImplicitHierarchy<DataType, 2, Layout>
 	{
 	};
 
-	template<typename DataType>
-	using BinaryIH = BinaryImplicitHierarchy<DataType>;
+	template<typename DataType, typename Layout = LevelOrderLayout>
+	using BinaryIH = BinaryImplicitHierarchy<DataType, Layout>;
 
 	//----------
 
-	template<typename DataType, size_t K>
-	ImplicitHierarchy<DataType, K>::ImplicitHierarchy()
+	template<typename DataType, size_t K, typename Layout>
+	ImplicitHierarchy<DataType, K, Layout>::ImplicitHierarchy() :
+		nodeCount_(0),
+		height_(0)
 	{
 	}
 
-	template<typename DataType, size_t K>
-	ImplicitHierarchy<DataType, K>::~ImplicitHierarchy()
+	template<typename DataType, size_t K, typename Layout>
+	ImplicitHierarchy<DataType, K, Layout>::~ImplicitHierarchy()
 	{
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::level(const MemoryBlock<DataType>& node) const
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::size() const
 	{
-		return level(this->getMemoryManager()->calculateIndex(node));
+		if constexpr (Layout::IS_LEVEL_ORDER)
+		{
+			return ImplicitAMS<DataType>::size();
+		}
+		else
+		{
+			return nodeCount_;
+		}
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::level(size_t index) const
+	template<typename DataType, size_t K, typename Layout>
+	AMT& ImplicitHierarchy<DataType, K, Layout>::assign(const AMT& other)
 	{
-		return static_cast<size_t>(std::floor(std::log((K - 1) * (index + 1)) / std::log(K)));
+		if (this != &other)
+		{
+			ImplicitAMS<DataType>::assign(other);
+			const ImplicitHierarchy<DataType, K, Layout>& otherHierarchy = dynamic_cast<const ImplicitHierarchy<DataType, K, Layout>&>(other);
+			nodeCount_ = otherHierarchy.nodeCount_;
+			height_ = otherHierarchy.height_;
+		}
+
+		return *this;
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::degree(const MemoryBlock<DataType>& node) const
+	template<typename DataType, size_t K, typename Layout>
+	void ImplicitHierarchy<DataType, K, Layout>::clear()
 	{
-		return degree(this->getMemoryManager()->calculateIndex(node));
+		ImplicitAMS<DataType>::clear();
+		nodeCount_ = 0;
+		height_ = 0;
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::degree(size_t index) const
+	template<typename DataType, size_t K, typename Layout>
+	bool ImplicitHierarchy<DataType, K, Layout>::equals(const AMT& other)
 	{
-		size_t currentLevel = level(index);
-		size_t indexOfLast = this->size() - 1;
-		size_t depth = level(indexOfLast);
-
-		if (currentLevel == depth)
+		if constexpr (Layout::IS_LEVEL_ORDER)
 		{
-			return 0;
+			return ImplicitAMS<DataType>::equals(other);
 		}
-		else if (currentLevel == depth - 1)
+		else
 		{
-			size_t indexOfLastsParent = indexOfParent(indexOfLast);
-			if (index < indexOfLastsParent)
+			if (this == &other)
 			{
-				return K;
+				return true;
 			}
-			else if (index > indexOfLastsParent)
+
+			// Same nodes may be laid out for different heights, so nodes are compared in level order.
+			const ImplicitHierarchy<DataType, K, Layout>* otherHierarchy = dynamic_cast<const ImplicitHierarchy<DataType, K, Layout>*>(&other);
+			if (otherHierarchy == nullptr || nodeCount_ != otherHierarchy->nodeCount_)
 			{
-				return 0;
+				return false;
 			}
-			else {
-				size_t mod = (this->size() - 1) % K;
-				return mod == 0 ? K : mod;
+
+			for (size_t index = 0; index < nodeCount_; ++index)
+			{
+				if (!(blockAt(index).data_ == otherHierarchy->blockAt(index).data_))
+				{
+					return false;
+				}
 			}
+			return true;
+		}
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::level(const MemoryBlock<DataType>& node) const
+	{
+		return level(indexOfBlock(node));
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::level(size_t index) const
+	{
+		// Level L starts at index (K^L - 1) / (K - 1).
+		if constexpr (IS_POWER_OF_TWO)
+		{
+			return details::floorLog2((K - 1) * index + 1) / details::floorLog2(K);
 		}
 		else
 		{
-			return K;
+			size_t result = LEVEL_STARTS.bitLengthLevels_[details::floorLog2(index + 1)];
+			return result + 1 < LEVEL_STARTS.count_ && index >= LEVEL_STARTS.starts_[result + 1] ? result + 1 : result;
+		}
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::degree(const MemoryBlock<DataType>& node) const
+	{
+		return degree(indexOfBlock(node));
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::degree(size_t index) const
+	{
+		size_t size = this->size();
+		size_t indexOfFirstSon = indexOfSon(index, 0);
+		return indexOfFirstSon < size ? std::min(K, size - indexOfFirstSon) : 0;
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	template<class OutputIterator>
+	OutputIterator ImplicitHierarchy<DataType, K, Layout>::levels(size_t firstIndex, size_t count, OutputIterator out) const
+	{
+		checkRange(firstIndex, count);
+
+		size_t currentLevel = count > 0 ? level(firstIndex) : 0;
+		size_t nextLevelStart = indexOfSon(LEVEL_STARTS.starts_[currentLevel], 0);
+		for (size_t index = firstIndex; index < firstIndex + count; ++index)
+		{
+			if (index == nextLevelStart)
+			{
+				++currentLevel;
+				nextLevelStart = indexOfSon(nextLevelStart, 0);
+			}
+			*out = currentLevel;
+			++out;
 		}
+		return out;
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::nodeCount(const MemoryBlock<DataType>& node) const
+	template<typename DataType, size_t K, typename Layout>
+	template<class OutputIterator>
+	OutputIterator ImplicitHierarchy<DataType, K, Layout>::degrees(size_t firstIndex, size_t count, OutputIterator out) const
 	{
-		return this->getMemoryManager()->calculateIndex(node) == 0 ? this->size() : Hierarchy<MemoryBlock<DataType>>::nodeCount(node);
+		checkRange(firstIndex, count);
+
+		// Inner nodes have K sons, at most one node has fewer and the rest are leaves.
+		size_t size = this->size();
+		size_t index = firstIndex;
+		size_t last = firstIndex + count;
+		for (; index < last && indexOfSon(index, K - 1) < size; ++index)
+		{
+			*out = K;
+			++out;
+		}
+		if (index < last && indexOfSon(index, 0) < size)
+		{
+			*out = size - indexOfSon(index, 0);
+			++out;
+			++index;
+		}
+		for (; index < last; ++index)
+		{
+			*out = 0;
+			++out;
+		}
+		return out;
 	}
 
-	template<typename DataType, size_t K>
-	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K>::accessRoot() const
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::nodeCount(const MemoryBlock<DataType>& node) const
 	{
-		return this->size() > 0 ? &this->getMemoryManager()->getBlockAt(0) : nullptr;
+		return indexOfBlock(node) == 0 ? this->size() : Hierarchy<MemoryBlock<DataType>>::nodeCount(node);
 	}
 
-	template<typename DataType, size_t K>
-	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K>::accessParent(const MemoryBlock<DataType>& node) const
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K, Layout>::accessRoot() const
+	{
+		return this->size() > 0 ? &blockAt(0) : nullptr;
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K, Layout>::accessParent(const MemoryBlock<DataType>& node) const
 	{
 		size_t index = indexOfParent(node);
-		return INVALID_INDEX != index ? &this->getMemoryManager()->getBlockAt(index) : nullptr;
+		return INVALID_INDEX != index ? &blockAt(index) : nullptr;
 	}
 
-	template<typename DataType, size_t K>
-	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K>::accessSon(const MemoryBlock<DataType>& node, size_t sonOrder) const
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K, Layout>::accessSon(const MemoryBlock<DataType>& node, size_t sonOrder) const
 	{
 		size_t index = indexOfSon(node, sonOrder);
-		return index < this->size() ? &this->getMemoryManager()->getBlockAt(index) : nullptr;
+		return index < this->size() ? &blockAt(index) : nullptr;
 	}
 
-	template<typename DataType, size_t K>
-	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K>::accessLastLeaf() const
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K, Layout>::accessLastLeaf() const
 	{
 		size_t size = this->size();
-		return size != 0 ? &this->getMemoryManager()->getBlockAt(size - 1) : nullptr;
+		return size != 0 ? &blockAt(size - 1) : nullptr;
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>* ImplicitHierarchy<DataType, K, Layout>::access(size_t index) const
+	{
+		return index < this->size() ? &blockAt(index) : nullptr;
 	}
 
-	template<typename DataType, size_t K>
-	MemoryBlock<DataType>& ImplicitHierarchy<DataType, K>::emplaceRoot()
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>& ImplicitHierarchy<DataType, K, Layout>::emplaceRoot()
 	{
 		throw unavailable_function_call("Method emplace_root() unavailable in implicit hierarchies!");
 	}
 
-	template<typename DataType, size_t K>
-	void ImplicitHierarchy<DataType, K>::changeRoot(MemoryBlock<DataType>* newRoot)
+	template<typename DataType, size_t K, typename Layout>
+	void ImplicitHierarchy<DataType, K, Layout>::changeRoot(MemoryBlock<DataType>* newRoot)
 	{
 		throw unavailable_function_call("Method changeRoot() unavailable in implicit hierarchies!");
 	}
 
-	template<typename DataType, size_t K>
-	MemoryBlock<DataType>& ImplicitHierarchy<DataType, K>::emplaceSon(MemoryBlock<DataType>& parent, size_t sonOrder)
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>& ImplicitHierarchy<DataType, K, Layout>::emplaceSon(MemoryBlock<DataType>& parent, size_t sonOrder)
 	{
 		throw unavailable_function_call("Method emplaceSon() unavailable in implicit hierarchies!");
 	}
 
-	template<typename DataType, size_t K>
-	void ImplicitHierarchy<DataType, K>::changeSon(MemoryBlock<DataType>& parent, size_t sonOrder, MemoryBlock<DataType>* newSon)
+	template<typename DataType, size_t K, typename Layout>
+	void ImplicitHierarchy<DataType, K, Layout>::changeSon(MemoryBlock<DataType>& parent, size_t sonOrder, MemoryBlock<DataType>* newSon)
 	{
 		throw unavailable_function_call("Method changeSon() unavailable in implicit hierarchies!");
 	}
 
-	template<typename DataType, size_t K>
-	void ImplicitHierarchy<DataType, K>::removeSon(MemoryBlock<DataType>& parent, size_t sonOrder)
+	template<typename DataType, size_t K, typename Layout>
+	void ImplicitHierarchy<DataType, K, Layout>::removeSon(MemoryBlock<DataType>& parent, size_t sonOrder)
 	{
 		throw unavailable_function_call("Method removeSon() unavailable in implicit hierarchies!");
 	}
 
-	template<typename DataType, size_t K>
-	MemoryBlock<DataType>& ImplicitHierarchy<DataType, K>::insertLastLeaf()
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>& ImplicitHierarchy<DataType, K, Layout>::insertLastLeaf()
 	{
-		return *this->getMemoryManager()->allocateMemory();
+		if constexpr (Layout::IS_LEVEL_ORDER)
+		{
+			return *this->getMemoryManager()->allocateMemory();
+		}
+		else
+		{
+			const size_t index = nodeCount_;
+			const size_t height = level(index) + 1;
+			if (height > height_)
+			{
+				changeHeight(height);
+			}
+
+			auto* memoryManager = this->getMemoryManager();
+			const size_t slotCount = Layout::slotCount(index + 1, height_);
+			while (memoryManager->getAllocatedBlockCount() < slotCount)
+			{
+				memoryManager->allocateMemory();
+			}
+			++nodeCount_;
+			return blockAt(index);
+		}
 	}
 
-	template<typename DataType, size_t K>
-	void ImplicitHierarchy<DataType, K>::removeLastLeaf()
+	template<typename DataType, size_t K, typename Layout>
+	void ImplicitHierarchy<DataType, K, Layout>::removeLastLeaf()
 	{
-		this->getMemoryManager()->releaseMemory();
+		if constexpr (Layout::IS_LEVEL_ORDER)
+		{
+			this->getMemoryManager()->releaseMemory();
+		}
+		else
+		{
+			if (nodeCount_ == 0)
+			{
+				throw std::out_of_range("Invalid index!");
+			}
+
+			// Slots of removed nodes stay allocated until they are at the end, so they are reset.
+			--nodeCount_;
+			blockAt(nodeCount_).data_ = DataType();
+			auto* memoryManager = this->getMemoryManager();
+			const size_t slotCount = Layout::slotCount(nodeCount_, height_);
+			while (memoryManager->getAllocatedBlockCount() > slotCount)
+			{
+				memoryManager->releaseMemory();
+			}
+		}
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::indexOfParent(const MemoryBlock<DataType>& node) const
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::indexOfParent(const MemoryBlock<DataType>& node) const
 	{
-		return indexOfParent(this->getMemoryManager()->calculateIndex(node));
+		return indexOfParent(indexOfBlock(node));
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::indexOfParent(size_t index) const
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::indexOfParent(size_t index) const
 	{
 		return 0 == index ? INVALID_INDEX : (index - 1) / K;
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::indexOfSon(const MemoryBlock<DataType>& node, size_t sonOrder) const
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::indexOfSon(const MemoryBlock<DataType>& node, size_t sonOrder) const
 	{
-		return indexOfSon(this->getMemoryManager()->calculateIndex(node), sonOrder);
+		return indexOfSon(indexOfBlock(node), sonOrder);
 	}
 
-	template<typename DataType, size_t K>
-	size_t ImplicitHierarchy<DataType, K>::indexOfSon(size_t indexOfParent, size_t sonOrder) const
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::indexOfSon(size_t indexOfParent, size_t sonOrder) const
 	{
 		return K * indexOfParent + sonOrder + 1;
 	}
 
+	template<typename DataType, size_t K, typename Layout>
+	void ImplicitHierarchy<DataType, K, Layout>::checkRange(size_t firstIndex, size_t count) const
+	{
+		if (firstIndex > this->size() || count > this->size() - firstIndex)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	size_t ImplicitHierarchy<DataType, K, Layout>::indexOfBlock(const MemoryBlock<DataType>& node) const
+	{
+		return Layout::indexOf(this->getMemoryManager()->calculateIndex(node), height_);
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	MemoryBlock<DataType>& ImplicitHierarchy<DataType, K, Layout>::blockAt(size_t index) const
+	{
+		return this->getMemoryManager()->getBlockAt(Layout::slotOf(index, height_));
+	}
+
+	template<typename DataType, size_t K, typename Layout>
+	void ImplicitHierarchy<DataType, K, Layout>::changeHeight(size_t height)
+	{
+		if (!Layout::DEPENDS_ON_HEIGHT || nodeCount_ == 0)
+		{
+			height_ = height;
+			return;
+		}
+
+		std::vector<DataType> data;
+		data.reserve(nodeCount_);
+		for (size_t index = 0; index < nodeCount_; ++index)
+		{
+			data.push_back(std::move(blockAt(index).data_));
+		}
+
+		auto* memoryManager = this->getMemoryManager();
+		const size_t slotCount = Layout::slotCount(nodeCount_, height);
+		memoryManager->clear();
+		if (memoryManager->getCapacity() < slotCount)
+		{
+			memoryManager->changeCapacity(slotCount);
+		}
+		for (size_t slot = 0; slot < slotCount; ++slot)
+		{
+			memoryManager->allocateMemory();
+		}
+
+		height_ = height;
+		for (size_t index = 0; index < nodeCount_; ++index)
+		{
+			blockAt(index).data_ = std::move(data[index]);
+		}
+	}
+
 }
\ No newline at end of file
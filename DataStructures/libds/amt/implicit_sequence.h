@@ -16,6 +16,8 @@ namespace ds::amt
 
 		ImplicitSequence();
 		ImplicitSequence(size_t capacity, bool initBlocks);
+		ImplicitSequence(size_t capacity, mm::GrowthPolicy* growthPolicy);
+		ImplicitSequence(typename ImplicitAMS<DataType>::MemoryManagerType* memoryManager);
 		ImplicitSequence(const ImplicitSequence<DataType>& other);
 		~ImplicitSequence() override;
 
@@ -39,7 +41,22 @@ namespace ds::amt
 		void removeNext(const BlockType& block) override;
 		void removePrevious(const BlockType& block) override;
 
+		BlockType* insertBlocks(size_t index, size_t count) override;
+		void removeRange(size_t index, size_t count) override;
+
+		void processAllBlocksForward(std::function<void(BlockType*)> operation) const override;
+		void processAllBlocksBackward(std::function<void(BlockType*)> operation) const override;
+		BlockType* findBlockWithProperty(std::function<bool(BlockType*)> predicate) const override;
+
+		template<typename Operation>
+		void forEach(Operation&& operation) const;
+		template<typename Operation>
+		void forEachBackward(Operation&& operation) const;
+		template<typename Predicate>
+		BlockType* findBlock(Predicate&& predicate) const;
+
 		void reserveCapacity(size_t capacity);
+		void shrinkCapacity();
 
 		virtual size_t indexOfNext(size_t currentIndex) const;
 		virtual size_t indexOfPrevious(size_t currentIndex) const;
@@ -65,6 +82,30 @@ namespace ds::amt
 		ImplicitSequenceIterator end();
 
 		using IteratorType = ImplicitSequenceIterator;
+
+	public:
+		/**
+		 * @brief Contiguous range of blocks, valid until the sequence is modified.
+		 */
+		class BlockSpan
+		{
+		public:
+			BlockSpan(BlockType* first, size_t size);
+			BlockType* begin() const;
+			BlockType* end() const;
+			BlockType& operator[](size_t index) const;
+			size_t size() const;
+			bool empty() const;
+
+		private:
+			BlockType* first_;
+			size_t size_;
+		};
+
+		/**
+		 * @brief Returns all blocks as one contiguous range.
+		 */
+		BlockSpan getBlocks();
 	};
 
 	template<typename DataType>
@@ -88,6 +129,23 @@ namespace ds::amt
 
 	//----------
 
+	/**
+	 * @brief Implicit sequence whose memory manager keeps a gap at the last edited index,
+	 * so repeated inserts and removals around one position are amortized O(1).
+	 */
+	template<typename DataType>
+	class GapImplicitSequence : public IS<DataType>
+	{
+	public:
+		GapImplicitSequence();
+		GapImplicitSequence(size_t initSize, bool initBlocks);
+	};
+
+	template<typename DataType>
+	using GIS = GapImplicitSequence<DataType>;
+
+	//----------
+
 	template<typename DataType>
 	ImplicitSequence<DataType>::ImplicitSequence()
 	{
@@ -99,6 +157,18 @@ namespace ds::amt
 	{
 	}
 
+	template<typename DataType>
+	ImplicitSequence<DataType>::ImplicitSequence(size_t capacity, mm::GrowthPolicy* growthPolicy) :
+		ImplicitAMS<DataType>(capacity, growthPolicy)
+	{
+	}
+
+	template<typename DataType>
+	ImplicitSequence<DataType>::ImplicitSequence(typename ImplicitAMS<DataType>::MemoryManagerType* memoryManager) :
+		ImplicitAMS<DataType>(memoryManager)
+	{
+	}
+
 	template<typename DataType>
 	ImplicitSequence<DataType>::ImplicitSequence(const ImplicitSequence<DataType>& other) :
 		ImplicitAMS<DataType>::ImplicitAbstractMemoryStructure(other)
@@ -202,6 +272,31 @@ namespace ds::amt
 		this->getMemoryManager()->releaseMemoryAt(index);
 	}
 
+	template<typename DataType>
+	auto ImplicitSequence<DataType>::insertBlocks(size_t index, size_t count) -> BlockType*
+	{
+		if (index > this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		return count > 0 ? this->getMemoryManager()->allocateMemoryAt(index, count) : nullptr;
+	}
+
+	template<typename DataType>
+	void ImplicitSequence<DataType>::removeRange(size_t index, size_t count)
+	{
+		if (index > this->size() || count > this->size() - index)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (count > 0)
+		{
+			this->getMemoryManager()->releaseMemoryAt(index, count);
+		}
+	}
+
 	template<typename DataType>
 	void ImplicitSequence<DataType>::removeNext(const BlockType& block)
 	{
@@ -216,12 +311,85 @@ namespace ds::amt
 		memManager->releaseMemoryAt(indexOfPrevious(memManager->calculateIndex(block)));
 	}
 
+	template<typename DataType>
+	void ImplicitSequence<DataType>::processAllBlocksForward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEach(operation);
+	}
+
+	template<typename DataType>
+	void ImplicitSequence<DataType>::processAllBlocksBackward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEachBackward(operation);
+	}
+
+	template<typename DataType>
+	auto ImplicitSequence<DataType>::findBlockWithProperty(std::function<bool(BlockType*)> predicate) const -> BlockType*
+	{
+		return this->findBlock(predicate);
+	}
+
+	template<typename DataType>
+	template<typename Operation>
+	void ImplicitSequence<DataType>::forEach(Operation&& operation) const
+	{
+		typename ImplicitAMS<DataType>::MemoryManagerType* memManager = this->getMemoryManager();
+		for (size_t segment = 0; segment < ImplicitAMS<DataType>::MemoryManagerType::SEGMENT_COUNT; ++segment)
+		{
+			BlockType* const end = memManager->getSegmentEnd(segment);
+			for (BlockType* block = memManager->getSegmentBegin(segment); block != end; ++block)
+			{
+				operation(block);
+			}
+		}
+	}
+
+	template<typename DataType>
+	template<typename Operation>
+	void ImplicitSequence<DataType>::forEachBackward(Operation&& operation) const
+	{
+		typename ImplicitAMS<DataType>::MemoryManagerType* memManager = this->getMemoryManager();
+		for (size_t segment = ImplicitAMS<DataType>::MemoryManagerType::SEGMENT_COUNT; segment > 0; --segment)
+		{
+			BlockType* const begin = memManager->getSegmentBegin(segment - 1);
+			for (BlockType* block = memManager->getSegmentEnd(segment - 1); block != begin; --block)
+			{
+				operation(block - 1);
+			}
+		}
+	}
+
+	template<typename DataType>
+	template<typename Predicate>
+	auto ImplicitSequence<DataType>::findBlock(Predicate&& predicate) const -> BlockType*
+	{
+		typename ImplicitAMS<DataType>::MemoryManagerType* memManager = this->getMemoryManager();
+		for (size_t segment = 0; segment < ImplicitAMS<DataType>::MemoryManagerType::SEGMENT_COUNT; ++segment)
+		{
+			BlockType* const end = memManager->getSegmentEnd(segment);
+			for (BlockType* block = memManager->getSegmentBegin(segment); block != end; ++block)
+			{
+				if (predicate(block))
+				{
+					return block;
+				}
+			}
+		}
+		return nullptr;
+	}
+
 	template<typename DataType>
 	void ImplicitSequence<DataType>::reserveCapacity(size_t capacity)
 	{
 		this->getMemoryManager()->changeCapacity(capacity);
 	}
 
+	template<typename DataType>
+	void ImplicitSequence<DataType>::shrinkCapacity()
+	{
+		this->getMemoryManager()->shrinkMemory();
+	}
+
 	template<typename DataType>
 	size_t ImplicitSequence<DataType>::indexOfNext(size_t currentIndex) const
 	{
@@ -294,6 +462,49 @@ namespace ds::amt
 		return ImplicitSequenceIterator(this, this->size());
 	}
 
+	template<typename DataType>
+	auto ImplicitSequence<DataType>::getBlocks() -> BlockSpan
+	{
+		return BlockSpan(this->getMemoryManager()->getContiguousBlocks(), this->size());
+	}
+
+	template<typename DataType>
+	ImplicitSequence<DataType>::BlockSpan::BlockSpan(BlockType* first, size_t size) :
+		first_(first),
+		size_(size)
+	{
+	}
+
+	template<typename DataType>
+	auto ImplicitSequence<DataType>::BlockSpan::begin() const -> BlockType*
+	{
+		return first_;
+	}
+
+	template<typename DataType>
+	auto ImplicitSequence<DataType>::BlockSpan::end() const -> BlockType*
+	{
+		return first_ + size_;
+	}
+
+	template<typename DataType>
+	auto ImplicitSequence<DataType>::BlockSpan::operator[](size_t index) const -> BlockType&
+	{
+		return first_[index];
+	}
+
+	template<typename DataType>
+	size_t ImplicitSequence<DataType>::BlockSpan::size() const
+	{
+		return size_;
+	}
+
+	template<typename DataType>
+	bool ImplicitSequence<DataType>::BlockSpan::empty() const
+	{
+		return size_ == 0;
+	}
+
 	template<typename DataType>
 	CyclicImplicitSequence<DataType>::CyclicImplicitSequence() :
 		IS<DataType>()
@@ -306,6 +517,20 @@ namespace ds::amt
 	{
 	}
 
+	template<typename DataType>
+	GapImplicitSequence<DataType>::GapImplicitSequence() :
+		IS<DataType>()
+	{
+		this->getMemoryManager()->useGapBuffer(true);
+	}
+
+	template<typename DataType>
+	GapImplicitSequence<DataType>::GapImplicitSequence(size_t initCapacity, bool initBlocks) :
+		IS<DataType>(initCapacity, initBlocks)
+	{
+		this->getMemoryManager()->useGapBuffer(true);
+	}
+
 	template<typename DataType>
 	size_t CyclicImplicitSequence<DataType>::indexOfNext(size_t currentIndex) const
 	{
@@ -0,0 +1,531 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/sequence.h>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::amt {
+
+	/**
+	 * @brief Implicit sequence stored in a ring buffer.
+	 *
+	 * All blocks of the memory manager are slots of the ring, their count is a power
+	 * of two. The first block is in the slot head_, so block at index i is in the slot
+	 * (head_ + i) & (capacity - 1). Inserting and removing at both ends is O(1),
+	 * in the middle the shorter side is moved. When the ring is full its capacity
+	 * doubles and at most half of the blocks are moved.
+	 */
+	template<typename DataType>
+	class RingImplicitSequence :
+		public Sequence<MemoryBlock<DataType>>,
+		public ImplicitAMS<DataType>
+	{
+	public:
+		using BlockType = MemoryBlock<DataType>;
+
+		RingImplicitSequence();
+		RingImplicitSequence(size_t capacity, bool initBlocks);
+		RingImplicitSequence(const RingImplicitSequence<DataType>& other);
+		~RingImplicitSequence() override;
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		size_t size() const override;
+		bool equals(const AMT& other) override;
+
+		size_t calculateIndex(BlockType& block) override;
+
+		BlockType* accessFirst() const override;
+		BlockType* accessLast() const override;
+		BlockType* access(size_t index) const override;
+		BlockType* accessNext(const BlockType& block) const override;
+		BlockType* accessPrevious(const BlockType& block) const override;
+
+		BlockType& insertFirst() override;
+		BlockType& insertLast() override;
+		BlockType& insert(size_t index) override;
+		BlockType& insertAfter(BlockType& block) override;
+		BlockType& insertBefore(BlockType& block) override;
+
+		void removeFirst() override;
+		void removeLast() override;
+		void remove(size_t index) override;
+		void removeNext(const BlockType& block) override;
+		void removePrevious(const BlockType& block) override;
+
+		BlockType* insertBlocks(size_t index, size_t count) override;
+		void removeRange(size_t index, size_t count) override;
+
+		void processAllBlocksForward(std::function<void(BlockType*)> operation) const override;
+		void processAllBlocksBackward(std::function<void(BlockType*)> operation) const override;
+
+		template<typename Operation>
+		void forEach(Operation&& operation) const;
+		template<typename Operation>
+		void forEachBackward(Operation&& operation) const;
+
+		void reserveCapacity(size_t capacity);
+		size_t getRingCapacity() const;
+
+		static constexpr size_t MIN_CAPACITY = 8;
+
+	private:
+		BlockType& slot(size_t index) const;
+		void moveBlocks(size_t destination, size_t source, size_t count);
+		void resetBlocks(size_t index, size_t count);
+
+	private:
+		size_t head_;
+		size_t size_;
+
+	public:
+		class RingImplicitSequenceIterator
+		{
+		public:
+			RingImplicitSequenceIterator(const RingImplicitSequence<DataType>* sequence, size_t position);
+			RingImplicitSequenceIterator& operator++();
+			RingImplicitSequenceIterator operator++(int);
+			bool operator==(const RingImplicitSequenceIterator& other) const;
+			bool operator!=(const RingImplicitSequenceIterator& other) const;
+			DataType& operator*();
+
+		private:
+			const RingImplicitSequence<DataType>* sequence_;
+			size_t position_;
+		};
+
+		using IteratorType = RingImplicitSequenceIterator;
+
+		IteratorType begin();
+		IteratorType end();
+	};
+
+	template<typename DataType>
+	using RingIS = RingImplicitSequence<DataType>;
+
+	//----------
+
+	template<typename DataType>
+	RingImplicitSequence<DataType>::RingImplicitSequence() :
+		head_(0),
+		size_(0)
+	{
+	}
+
+	template<typename DataType>
+	RingImplicitSequence<DataType>::RingImplicitSequence(size_t capacity, bool initBlocks) :
+		RingImplicitSequence()
+	{
+		this->reserveCapacity(capacity);
+		if (initBlocks)
+		{
+			size_ = capacity;
+		}
+	}
+
+	template<typename DataType>
+	RingImplicitSequence<DataType>::RingImplicitSequence(const RingImplicitSequence<DataType>& other) :
+		RingImplicitSequence()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType>
+	RingImplicitSequence<DataType>::~RingImplicitSequence()
+	{
+	}
+
+	template<typename DataType>
+	AMT& RingImplicitSequence<DataType>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			const RingImplicitSequence<DataType>& otherSequence = dynamic_cast<const RingImplicitSequence<DataType>&>(other);
+
+			this->clear();
+			this->reserveCapacity(otherSequence.size_);
+			for (size_t i = 0; i < otherSequence.size_; ++i)
+			{
+				this->slot(i).data_ = otherSequence.slot(i).data_;
+			}
+			size_ = otherSequence.size_;
+		}
+
+		return *this;
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::clear()
+	{
+		ImplicitAMS<DataType>::clear();
+		head_ = 0;
+		size_ = 0;
+	}
+
+	template<typename DataType>
+	size_t RingImplicitSequence<DataType>::size() const
+	{
+		return size_;
+	}
+
+	template<typename DataType>
+	bool RingImplicitSequence<DataType>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		const RingImplicitSequence<DataType>* otherSequence = dynamic_cast<const RingImplicitSequence<DataType>*>(&other);
+		if (otherSequence == nullptr || size_ != otherSequence->size_)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < size_; ++i)
+		{
+			if (!(this->slot(i).data_ == otherSequence->slot(i).data_))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename DataType>
+	size_t RingImplicitSequence<DataType>::calculateIndex(BlockType& block)
+	{
+		const size_t position = this->getMemoryManager()->calculateIndex(block);
+		if (position == INVALID_INDEX)
+		{
+			return INVALID_INDEX;
+		}
+
+		const size_t index = (position - head_) & (this->getRingCapacity() - 1);
+		return index < size_ ? index : INVALID_INDEX;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::accessFirst() const -> BlockType*
+	{
+		return size_ > 0 ? &this->slot(0) : nullptr;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::accessLast() const -> BlockType*
+	{
+		return size_ > 0 ? &this->slot(size_ - 1) : nullptr;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::access(size_t index) const -> BlockType*
+	{
+		return index < size_ ? &this->slot(index) : nullptr;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::accessNext(const BlockType& block) const -> BlockType*
+	{
+		const size_t index = const_cast<RingImplicitSequence<DataType>*>(this)->calculateIndex(const_cast<BlockType&>(block));
+		return index != INVALID_INDEX ? this->access(index + 1) : nullptr;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::accessPrevious(const BlockType& block) const -> BlockType*
+	{
+		const size_t index = const_cast<RingImplicitSequence<DataType>*>(this)->calculateIndex(const_cast<BlockType&>(block));
+		return index != INVALID_INDEX && index > 0 ? &this->slot(index - 1) : nullptr;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::insertFirst() -> BlockType&
+	{
+		this->reserveCapacity(size_ + 1);
+		head_ = (head_ - 1) & (this->getRingCapacity() - 1);
+		++size_;
+		return this->slot(0);
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::insertLast() -> BlockType&
+	{
+		this->reserveCapacity(size_ + 1);
+		++size_;
+		return this->slot(size_ - 1);
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::insert(size_t index) -> BlockType&
+	{
+		return *this->insertBlocks(index, 1);
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::insertAfter(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->calculateIndex(block) + 1);
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::insertBefore(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->calculateIndex(block));
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::removeFirst()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		this->resetBlocks(0, 1);
+		head_ = (head_ + 1) & (this->getRingCapacity() - 1);
+		--size_;
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::removeLast()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		this->resetBlocks(size_ - 1, 1);
+		--size_;
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::remove(size_t index)
+	{
+		this->removeRange(index, 1);
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::removeNext(const BlockType& block)
+	{
+		this->remove(this->calculateIndex(const_cast<BlockType&>(block)) + 1);
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::removePrevious(const BlockType& block)
+	{
+		this->remove(this->calculateIndex(const_cast<BlockType&>(block)) - 1);
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::insertBlocks(size_t index, size_t count) -> BlockType*
+	{
+		if (index > size_)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (count == 0)
+		{
+			return nullptr;
+		}
+
+		this->reserveCapacity(size_ + count);
+
+		if (index < size_ - index)
+		{
+			head_ = (head_ - count) & (this->getRingCapacity() - 1);
+			this->moveBlocks(0, count, index);
+		}
+		else
+		{
+			this->moveBlocks(index + count, index, size_ - index);
+		}
+
+		size_ += count;
+		this->resetBlocks(index, count);
+		return &this->slot(index);
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::removeRange(size_t index, size_t count)
+	{
+		if (index > size_ || count > size_ - index)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (index < size_ - index - count)
+		{
+			this->moveBlocks(count, 0, index);
+			this->resetBlocks(0, count);
+			head_ = (head_ + count) & (this->getRingCapacity() - 1);
+		}
+		else
+		{
+			this->moveBlocks(index, index + count, size_ - index - count);
+			this->resetBlocks(size_ - count, count);
+		}
+
+		size_ -= count;
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::processAllBlocksForward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEach(operation);
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::processAllBlocksBackward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEachBackward(operation);
+	}
+
+	template<typename DataType>
+	template<typename Operation>
+	void RingImplicitSequence<DataType>::forEach(Operation&& operation) const
+	{
+		for (size_t i = 0; i < size_; ++i)
+		{
+			operation(&this->slot(i));
+		}
+	}
+
+	template<typename DataType>
+	template<typename Operation>
+	void RingImplicitSequence<DataType>::forEachBackward(Operation&& operation) const
+	{
+		for (size_t i = size_; i > 0; --i)
+		{
+			operation(&this->slot(i - 1));
+		}
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::reserveCapacity(size_t capacity)
+	{
+		const size_t oldCapacity = this->getRingCapacity();
+		if (capacity <= oldCapacity)
+		{
+			return;
+		}
+
+		const size_t newCapacity = details::ceilPowerOfTwo((std::max)(capacity, (std::max)(2 * oldCapacity, MIN_CAPACITY)));
+		this->getMemoryManager()->allocateMemoryAt(oldCapacity, newCapacity - oldCapacity);
+
+		// Blocks wrapped around the end of the old ring are moved behind it,
+		// or the blocks from the head to the old end are moved to the new end.
+		const size_t wrapped = head_ + size_ > oldCapacity ? head_ + size_ - oldCapacity : 0;
+		if (wrapped > 0)
+		{
+			MemoryBlock<DataType>* blocks = &this->getMemoryManager()->getBlockAt(0);
+			const size_t headCount = oldCapacity - head_;
+			if (wrapped <= headCount)
+			{
+				std::move(blocks, blocks + wrapped, blocks + oldCapacity);
+				std::fill(blocks, blocks + wrapped, BlockType());
+			}
+			else
+			{
+				std::move(blocks + head_, blocks + oldCapacity, blocks + newCapacity - headCount);
+				std::fill(blocks + head_, blocks + oldCapacity, BlockType());
+				head_ = newCapacity - headCount;
+			}
+		}
+	}
+
+	template<typename DataType>
+	size_t RingImplicitSequence<DataType>::getRingCapacity() const
+	{
+		return this->getMemoryManager()->getAllocatedBlockCount();
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::slot(size_t index) const -> BlockType&
+	{
+		return this->getMemoryManager()->getBlockAt((head_ + index) & (this->getRingCapacity() - 1));
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::moveBlocks(size_t destination, size_t source, size_t count)
+	{
+		if (destination < source)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				this->slot(destination + i).data_ = std::move(this->slot(source + i).data_);
+			}
+		}
+		else
+		{
+			for (size_t i = count; i > 0; --i)
+			{
+				this->slot(destination + i - 1).data_ = std::move(this->slot(source + i - 1).data_);
+			}
+		}
+	}
+
+	template<typename DataType>
+	void RingImplicitSequence<DataType>::resetBlocks(size_t index, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			this->slot(index + i).data_ = DataType();
+		}
+	}
+
+	template<typename DataType>
+	RingImplicitSequence<DataType>::RingImplicitSequenceIterator::RingImplicitSequenceIterator(const RingImplicitSequence<DataType>* sequence, size_t position) :
+		sequence_(sequence),
+		position_(position)
+	{
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::RingImplicitSequenceIterator::operator++() -> RingImplicitSequenceIterator&
+	{
+		++position_;
+		return *this;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::RingImplicitSequenceIterator::operator++(int) -> RingImplicitSequenceIterator
+	{
+		RingImplicitSequenceIterator tmp(*this);
+		operator++();
+		return tmp;
+	}
+
+	template<typename DataType>
+	bool RingImplicitSequence<DataType>::RingImplicitSequenceIterator::operator==(const RingImplicitSequenceIterator& other) const
+	{
+		return sequence_ == other.sequence_ && position_ == other.position_;
+	}
+
+	template<typename DataType>
+	bool RingImplicitSequence<DataType>::RingImplicitSequenceIterator::operator!=(const RingImplicitSequenceIterator& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename DataType>
+	DataType& RingImplicitSequence<DataType>::RingImplicitSequenceIterator::operator*()
+	{
+		return sequence_->slot(position_).data_;
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::begin() -> IteratorType
+	{
+		return RingImplicitSequenceIterator(this, 0);
+	}
+
+	template<typename DataType>
+	auto RingImplicitSequence<DataType>::end() -> IteratorType
+	{
+		return RingImplicitSequenceIterator(this, size_);
+	}
+
+}
@@ -0,0 +1,1020 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/sequence.h>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::amt {
+
+	template<typename DataType, size_t N>
+	struct RopeSequenceNode;
+
+	template<typename DataType, size_t N>
+	struct RopeSequenceNodeData
+	{
+		RopeSequenceNodeData() :
+			left_(nullptr),
+			right_(nullptr),
+			parent_(nullptr),
+			size_(0),
+			nodeCount_(1),
+			count_(0),
+			priority_(0)
+		{
+		}
+
+		RopeSequenceNode<DataType, N>* left_;
+		RopeSequenceNode<DataType, N>* right_;
+		RopeSequenceNode<DataType, N>* parent_;
+		size_t size_;
+		size_t nodeCount_;
+		size_t count_;
+		uint_fast32_t priority_;
+		MemoryBlock<DataType> blocks_[N];
+	};
+
+	/**
+	 * @brief Node of a rope holding up to N consecutive blocks, together with the number
+	 * of blocks and nodes in its subtree.
+	 */
+	template<typename DataType, size_t N>
+	struct RopeSequenceNode :
+		public details::AlignedNode<RopeSequenceNodeData<DataType, N>>
+	{
+	};
+
+	//----------
+
+	/**
+	 * @brief Sequence stored in a treap of nodes each holding up to N blocks contiguously.
+	 *
+	 * Nodes are ordered by position and every node knows how many blocks its subtree
+	 * holds, so access by index, insert and remove are O(log n). Whole sequences are
+	 * joined by concat and insertRange and cut by splitAt in O(log n) by relinking
+	 * nodes, blocks are moved only within the node at the cut. Nodes can be passed
+	 * between sequences only if both allocate them with the plain memory manager,
+	 * otherwise the blocks are copied.
+	 */
+	template<typename DataType, size_t N>
+	class RopeSequence :
+		public Sequence<MemoryBlock<DataType>>,
+		public ExplicitAMS<RopeSequenceNode<DataType, N>>
+	{
+		static_assert(N >= 2, "Node has to hold at least two blocks.");
+
+	public:
+		using BlockType = MemoryBlock<DataType>;
+		using NodeType = RopeSequenceNode<DataType, N>;
+
+		RopeSequence();
+		RopeSequence(mm::MemoryManager<NodeType>* memoryManager);
+		RopeSequence(const RopeSequence& other);
+		~RopeSequence() override;
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		size_t size() const override;
+		bool equals(const AMT& other) override;
+
+		size_t calculateIndex(BlockType& block) override;
+
+		BlockType* accessFirst() const override;
+		BlockType* accessLast() const override;
+		BlockType* access(size_t index) const override;
+		BlockType* accessNext(const BlockType& block) const override;
+		BlockType* accessPrevious(const BlockType& block) const override;
+
+		BlockType& insertFirst() override;
+		BlockType& insertLast() override;
+		BlockType& insert(size_t index) override;
+		BlockType& insertAfter(BlockType& block) override;
+		BlockType& insertBefore(BlockType& block) override;
+
+		void removeFirst() override;
+		void removeLast() override;
+		void remove(size_t index) override;
+		void removeNext(const BlockType& block) override;
+		void removePrevious(const BlockType& block) override;
+
+		BlockType* insertBlocks(size_t index, size_t count) override;
+		void removeRange(size_t index, size_t count) override;
+		using Sequence<MemoryBlock<DataType>>::insertRange;
+
+		void processAllBlocksForward(std::function<void(BlockType*)> operation) const override;
+		void processAllBlocksBackward(std::function<void(BlockType*)> operation) const override;
+
+		template<typename Operation>
+		void forEach(Operation&& operation) const;
+		template<typename Operation>
+		void forEachBackward(Operation&& operation) const;
+
+		/**
+		 * @brief Moves all blocks of @p other behind the last block, @p other stays empty.
+		 */
+		void concat(RopeSequence& other);
+
+		/**
+		 * @brief Moves blocks from @p index to the end in front of the blocks of @p other.
+		 * Splitting a sequence and concatenating the parts back restores it.
+		 */
+		void splitAt(size_t index, RopeSequence& other);
+
+		/**
+		 * @brief Moves all blocks of @p other in front of the block at @p index, @p other stays empty.
+		 */
+		void insertRange(size_t index, RopeSequence& other);
+
+		size_t getNodeCount() const;
+
+		static constexpr size_t NODE_CAPACITY = N;
+
+	private:
+		static size_t sizeOf(const NodeType* node);
+		static size_t nodeCountOf(const NodeType* node);
+		static NodeType* leftmost(NodeType* node);
+		static NodeType* rightmost(NodeType* node);
+		static NodeType* nextNode(NodeType* node);
+		static NodeType* previousNode(NodeType* node);
+		static void update(NodeType* node);
+		static void updatePath(NodeType* node);
+
+		NodeType* createNode();
+		void releaseSubtree(NodeType* node);
+		NodeType* merge(NodeType* left, NodeType* right);
+		void split(NodeType* node, size_t index, NodeType*& left, NodeType*& right);
+		NodeType* findNode(size_t& index, bool includeEnd) const;
+		size_t indexOfNode(const NodeType* node) const;
+		size_t indexOf(const BlockType& block) const;
+		NodeType* splitNode(NodeType* node, size_t position);
+		void removeNode(NodeType* node);
+		bool adoptNodes(RopeSequence& other, const NodeType* subtree);
+		void setRoot(NodeType* root);
+
+	private:
+		NodeType* root_;
+		std::minstd_rand random_;
+
+	public:
+		class RopeSequenceIterator
+		{
+		public:
+			RopeSequenceIterator(NodeType* node, size_t position);
+			RopeSequenceIterator& operator++();
+			RopeSequenceIterator operator++(int);
+			bool operator==(const RopeSequenceIterator& other) const;
+			bool operator!=(const RopeSequenceIterator& other) const;
+			DataType& operator*();
+
+		private:
+			NodeType* node_;
+			size_t position_;
+		};
+
+		using IteratorType = RopeSequenceIterator;
+
+		IteratorType begin();
+		IteratorType end();
+	};
+
+	template<typename DataType, size_t N = 64>
+	using RopeS = RopeSequence<DataType, N>;
+
+	//----------
+
+	template<typename DataType, size_t N>
+	RopeSequence<DataType, N>::RopeSequence() :
+		root_(nullptr)
+	{
+	}
+
+	template<typename DataType, size_t N>
+	RopeSequence<DataType, N>::RopeSequence(mm::MemoryManager<NodeType>* memoryManager) :
+		ExplicitAMS<NodeType>(memoryManager),
+		root_(nullptr)
+	{
+	}
+
+	template<typename DataType, size_t N>
+	RopeSequence<DataType, N>::RopeSequence(const RopeSequence& other) :
+		RopeSequence()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType, size_t N>
+	RopeSequence<DataType, N>::~RopeSequence()
+	{
+		RopeSequence<DataType, N>::clear();
+	}
+
+	template<typename DataType, size_t N>
+	AMT& RopeSequence<DataType, N>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+
+			const RopeSequence<DataType, N>& otherSequence = dynamic_cast<const RopeSequence<DataType, N>&>(other);
+			otherSequence.forEach([this](const BlockType* block)
+				{
+					this->insertLast().data_ = block->data_;
+				});
+		}
+
+		return *this;
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::clear()
+	{
+		if (!this->tryReleaseAllBlocks())
+		{
+			this->releaseSubtree(root_);
+		}
+
+		root_ = nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	size_t RopeSequence<DataType, N>::size() const
+	{
+		return sizeOf(root_);
+	}
+
+	template<typename DataType, size_t N>
+	bool RopeSequence<DataType, N>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		if (this->size() != other.size())
+		{
+			return false;
+		}
+
+		const RopeSequence<DataType, N>* otherSequence = dynamic_cast<const RopeSequence<DataType, N>*>(&other);
+		if (otherSequence == nullptr)
+		{
+			return false;
+		}
+
+		BlockType* myCurrent = this->accessFirst();
+		BlockType* otherCurrent = otherSequence->accessFirst();
+
+		while (myCurrent != nullptr)
+		{
+			if (!(myCurrent->data_ == otherCurrent->data_))
+			{
+				return false;
+			}
+
+			myCurrent = this->accessNext(*myCurrent);
+			otherCurrent = otherSequence->accessNext(*otherCurrent);
+		}
+
+		return true;
+	}
+
+	template<typename DataType, size_t N>
+	size_t RopeSequence<DataType, N>::calculateIndex(BlockType& block)
+	{
+		// The block may come from elsewhere, so nodes are only compared, never read through it.
+		const NodeType* blockNode = details::nodeOfBlock<NodeType>(block);
+		size_t index = 0;
+
+		for (NodeType* node = root_ != nullptr ? leftmost(root_) : nullptr; node != nullptr; node = nextNode(node))
+		{
+			if (node == blockNode)
+			{
+				const size_t position = details::indexInNode(node, block);
+				return position < node->count_ ? index + position : INVALID_INDEX;
+			}
+			index += node->count_;
+		}
+
+		return INVALID_INDEX;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::accessFirst() const -> BlockType*
+	{
+		return root_ != nullptr ? &leftmost(root_)->blocks_[0] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::accessLast() const -> BlockType*
+	{
+		if (root_ == nullptr)
+		{
+			return nullptr;
+		}
+
+		NodeType* last = rightmost(root_);
+		return &last->blocks_[last->count_ - 1];
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::access(size_t index) const -> BlockType*
+	{
+		NodeType* node = this->findNode(index, false);
+		return node != nullptr ? &node->blocks_[index] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::accessNext(const BlockType& block) const -> BlockType*
+	{
+		NodeType* node = details::nodeOfBlock<NodeType>(block);
+		const size_t position = details::indexInNode(node, block) + 1;
+
+		if (position < node->count_)
+		{
+			return &node->blocks_[position];
+		}
+
+		NodeType* next = nextNode(node);
+		return next != nullptr ? &next->blocks_[0] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::accessPrevious(const BlockType& block) const -> BlockType*
+	{
+		NodeType* node = details::nodeOfBlock<NodeType>(block);
+		const size_t position = details::indexInNode(node, block);
+
+		if (position > 0)
+		{
+			return &node->blocks_[position - 1];
+		}
+
+		NodeType* previous = previousNode(node);
+		return previous != nullptr ? &previous->blocks_[previous->count_ - 1] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::insertFirst() -> BlockType&
+	{
+		return this->insert(0);
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::insertLast() -> BlockType&
+	{
+		return this->insert(this->size());
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::insert(size_t index) -> BlockType&
+	{
+		if (index > this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (root_ == nullptr)
+		{
+			this->setRoot(this->createNode());
+		}
+
+		size_t position = index;
+		NodeType* node = this->findNode(position, true);
+
+		if (node->count_ == N)
+		{
+			// Appending behind a full node starts a new one, so filling the
+			// sequence from one end leaves full nodes behind.
+			const size_t half = position == N ? N : N / 2;
+			NodeType* tail = this->splitNode(node, half);
+			if (position >= half)
+			{
+				node = tail;
+				position -= half;
+			}
+		}
+
+		std::move_backward(node->blocks_ + position, node->blocks_ + node->count_, node->blocks_ + node->count_ + 1);
+		node->blocks_[position].data_ = DataType();
+		++node->count_;
+		updatePath(node);
+
+		return node->blocks_[position];
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::insertAfter(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->indexOf(block) + 1);
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::insertBefore(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->indexOf(block));
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::removeFirst()
+	{
+		this->remove(0);
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::removeLast()
+	{
+		this->remove(this->size() - 1);
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::remove(size_t index)
+	{
+		NodeType* node = this->findNode(index, false);
+		if (node == nullptr)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		std::move(node->blocks_ + index + 1, node->blocks_ + node->count_, node->blocks_ + index);
+		--node->count_;
+		node->blocks_[node->count_].data_ = DataType();
+
+		if (node->count_ == 0)
+		{
+			this->removeNode(node);
+			return;
+		}
+
+		NodeType* next = node->count_ < N / 2 ? nextNode(node) : nullptr;
+		if (next != nullptr && node->count_ + next->count_ <= N)
+		{
+			std::move(next->blocks_, next->blocks_ + next->count_, node->blocks_ + node->count_);
+			node->count_ += next->count_;
+			next->count_ = 0;
+			updatePath(node);
+			this->removeNode(next);
+		}
+		else
+		{
+			updatePath(node);
+		}
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::removeNext(const BlockType& block)
+	{
+		this->remove(this->indexOf(block) + 1);
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::removePrevious(const BlockType& block)
+	{
+		this->remove(this->indexOf(block) - 1);
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::insertBlocks(size_t index, size_t count) -> BlockType*
+	{
+		if (index > this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (count == 0)
+		{
+			return nullptr;
+		}
+
+		// New blocks fill whole nodes, which are joined together and put in at once.
+		NodeType* range = nullptr;
+		for (size_t remaining = count; remaining > 0;)
+		{
+			NodeType* node = this->createNode();
+			node->count_ = remaining < N ? remaining : N;
+			for (size_t i = 0; i < node->count_; ++i)
+			{
+				node->blocks_[i].data_ = DataType();
+			}
+			update(node);
+			range = this->merge(range, node);
+			remaining -= node->count_;
+		}
+
+		NodeType* left;
+		NodeType* right;
+		this->split(root_, index, left, right);
+		this->setRoot(this->merge(this->merge(left, range), right));
+
+		return this->access(index);
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::removeRange(size_t index, size_t count)
+	{
+		if (index > this->size() || count > this->size() - index)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (count == 0)
+		{
+			return;
+		}
+
+		NodeType* left;
+		NodeType* middle;
+		NodeType* right;
+		this->split(root_, index, left, middle);
+		this->split(middle, count, middle, right);
+		this->releaseSubtree(middle);
+		this->setRoot(this->merge(left, right));
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::processAllBlocksForward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEach(operation);
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::processAllBlocksBackward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEachBackward(operation);
+	}
+
+	template<typename DataType, size_t N>
+	template<typename Operation>
+	void RopeSequence<DataType, N>::forEach(Operation&& operation) const
+	{
+		for (NodeType* node = root_ != nullptr ? leftmost(root_) : nullptr; node != nullptr; node = nextNode(node))
+		{
+			for (size_t i = 0; i < node->count_; ++i)
+			{
+				operation(&node->blocks_[i]);
+			}
+		}
+	}
+
+	template<typename DataType, size_t N>
+	template<typename Operation>
+	void RopeSequence<DataType, N>::forEachBackward(Operation&& operation) const
+	{
+		for (NodeType* node = root_ != nullptr ? rightmost(root_) : nullptr; node != nullptr; node = previousNode(node))
+		{
+			for (size_t i = node->count_; i > 0; --i)
+			{
+				operation(&node->blocks_[i - 1]);
+			}
+		}
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::concat(RopeSequence& other)
+	{
+		this->insertRange(this->size(), other);
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::splitAt(size_t index, RopeSequence& other)
+	{
+		if (index > this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (this == &other)
+		{
+			return;
+		}
+
+		NodeType* left;
+		NodeType* right;
+		this->split(root_, index, left, right);
+		this->setRoot(left);
+
+		if (other.adoptNodes(*this, right))
+		{
+			other.setRoot(other.merge(right, other.root_));
+			return;
+		}
+
+		size_t position = 0;
+		for (NodeType* node = right != nullptr ? leftmost(right) : nullptr; node != nullptr; node = nextNode(node))
+		{
+			for (size_t i = 0; i < node->count_; ++i)
+			{
+				other.insert(position++).data_ = node->blocks_[i].data_;
+			}
+		}
+		this->releaseSubtree(right);
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::insertRange(size_t index, RopeSequence& other)
+	{
+		if (index > this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		if (this == &other || other.root_ == nullptr)
+		{
+			return;
+		}
+
+		if (this->adoptNodes(other, other.root_))
+		{
+			NodeType* left;
+			NodeType* right;
+			this->split(root_, index, left, right);
+			this->setRoot(this->merge(this->merge(left, other.root_), right));
+			other.setRoot(nullptr);
+			return;
+		}
+
+		other.forEach([this, &index](const BlockType* block)
+			{
+				this->insert(index++).data_ = block->data_;
+			});
+		other.clear();
+	}
+
+	template<typename DataType, size_t N>
+	size_t RopeSequence<DataType, N>::getNodeCount() const
+	{
+		return nodeCountOf(root_);
+	}
+
+	template<typename DataType, size_t N>
+	size_t RopeSequence<DataType, N>::sizeOf(const NodeType* node)
+	{
+		return node != nullptr ? node->size_ : 0;
+	}
+
+	template<typename DataType, size_t N>
+	size_t RopeSequence<DataType, N>::nodeCountOf(const NodeType* node)
+	{
+		return node != nullptr ? node->nodeCount_ : 0;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::leftmost(NodeType* node) -> NodeType*
+	{
+		while (node->left_ != nullptr)
+		{
+			node = node->left_;
+		}
+		return node;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::rightmost(NodeType* node) -> NodeType*
+	{
+		while (node->right_ != nullptr)
+		{
+			node = node->right_;
+		}
+		return node;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::nextNode(NodeType* node) -> NodeType*
+	{
+		if (node->right_ != nullptr)
+		{
+			return leftmost(node->right_);
+		}
+
+		while (node->parent_ != nullptr && node->parent_->right_ == node)
+		{
+			node = node->parent_;
+		}
+		return node->parent_;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::previousNode(NodeType* node) -> NodeType*
+	{
+		if (node->left_ != nullptr)
+		{
+			return rightmost(node->left_);
+		}
+
+		while (node->parent_ != nullptr && node->parent_->left_ == node)
+		{
+			node = node->parent_;
+		}
+		return node->parent_;
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::update(NodeType* node)
+	{
+		node->size_ = sizeOf(node->left_) + node->count_ + sizeOf(node->right_);
+		node->nodeCount_ = nodeCountOf(node->left_) + 1 + nodeCountOf(node->right_);
+
+		if (node->left_ != nullptr)
+		{
+			node->left_->parent_ = node;
+		}
+		if (node->right_ != nullptr)
+		{
+			node->right_->parent_ = node;
+		}
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::updatePath(NodeType* node)
+	{
+		for (; node != nullptr; node = node->parent_)
+		{
+			update(node);
+		}
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::createNode() -> NodeType*
+	{
+		NodeType* node = AMS<NodeType>::memoryManager_->allocateMemory();
+		node->priority_ = random_();
+		return node;
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::releaseSubtree(NodeType* node)
+	{
+		// Left spine is turned into a list of right children, so no recursion is needed.
+		while (node != nullptr)
+		{
+			if (node->left_ != nullptr)
+			{
+				NodeType* left = node->left_;
+				node->left_ = left->right_;
+				left->right_ = node;
+				node = left;
+			}
+			else
+			{
+				NodeType* right = node->right_;
+				AMS<NodeType>::memoryManager_->releaseMemory(node);
+				node = right;
+			}
+		}
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::merge(NodeType* left, NodeType* right) -> NodeType*
+	{
+		if (left == nullptr)
+		{
+			return right;
+		}
+
+		if (right == nullptr)
+		{
+			return left;
+		}
+
+		if (left->priority_ > right->priority_)
+		{
+			left->right_ = this->merge(left->right_, right);
+			update(left);
+			return left;
+		}
+
+		right->left_ = this->merge(left, right->left_);
+		update(right);
+		return right;
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::split(NodeType* node, size_t index, NodeType*& left, NodeType*& right)
+	{
+		if (node == nullptr)
+		{
+			left = nullptr;
+			right = nullptr;
+			return;
+		}
+
+		const size_t leftSize = sizeOf(node->left_);
+
+		if (index <= leftSize)
+		{
+			this->split(node->left_, index, left, node->left_);
+			update(node);
+			right = node;
+		}
+		else if (index >= leftSize + node->count_)
+		{
+			this->split(node->right_, index - leftSize - node->count_, node->right_, right);
+			update(node);
+			left = node;
+		}
+		else
+		{
+			const size_t position = index - leftSize;
+			NodeType* tail = this->createNode();
+			std::move(node->blocks_ + position, node->blocks_ + node->count_, tail->blocks_);
+			for (size_t i = position; i < node->count_; ++i)
+			{
+				node->blocks_[i].data_ = DataType();
+			}
+			tail->count_ = node->count_ - position;
+			node->count_ = position;
+			update(tail);
+
+			NodeType* rest = node->right_;
+			node->right_ = nullptr;
+			update(node);
+			left = node;
+			right = this->merge(tail, rest);
+		}
+
+		if (left != nullptr)
+		{
+			left->parent_ = nullptr;
+		}
+		if (right != nullptr)
+		{
+			right->parent_ = nullptr;
+		}
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::findNode(size_t& index, bool includeEnd) const -> NodeType*
+	{
+		if (index > this->size() || (index == this->size() && !includeEnd))
+		{
+			return nullptr;
+		}
+
+		NodeType* node = root_;
+		while (node != nullptr)
+		{
+			const size_t leftSize = sizeOf(node->left_);
+			if (index < leftSize)
+			{
+				node = node->left_;
+			}
+			else if (index < leftSize + node->count_ || (index == leftSize + node->count_ && node->right_ == nullptr))
+			{
+				index -= leftSize;
+				return node;
+			}
+			else
+			{
+				index -= leftSize + node->count_;
+				node = node->right_;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	size_t RopeSequence<DataType, N>::indexOfNode(const NodeType* node) const
+	{
+		size_t index = sizeOf(node->left_);
+		while (node->parent_ != nullptr)
+		{
+			if (node->parent_->right_ == node)
+			{
+				index += sizeOf(node->parent_->left_) + node->parent_->count_;
+			}
+			node = node->parent_;
+		}
+
+		return index;
+	}
+
+	template<typename DataType, size_t N>
+	size_t RopeSequence<DataType, N>::indexOf(const BlockType& block) const
+	{
+		const NodeType* node = details::nodeOfBlock<NodeType>(block);
+		return this->indexOfNode(node) + details::indexInNode(node, block);
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::splitNode(NodeType* node, size_t position) -> NodeType*
+	{
+		const size_t end = this->indexOfNode(node) + node->count_;
+		NodeType* tail = this->createNode();
+
+		std::move(node->blocks_ + position, node->blocks_ + node->count_, tail->blocks_);
+		for (size_t i = position; i < node->count_; ++i)
+		{
+			node->blocks_[i].data_ = DataType();
+		}
+		tail->count_ = node->count_ - position;
+		node->count_ = position;
+		updatePath(node);
+		update(tail);
+
+		NodeType* left;
+		NodeType* right;
+		this->split(root_, end - tail->count_, left, right);
+		this->setRoot(this->merge(this->merge(left, tail), right));
+
+		return tail;
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::removeNode(NodeType* node)
+	{
+		NodeType* parent = node->parent_;
+		NodeType* child = this->merge(node->left_, node->right_);
+
+		if (child != nullptr)
+		{
+			child->parent_ = parent;
+		}
+
+		if (parent == nullptr)
+		{
+			root_ = child;
+		}
+		else
+		{
+			(parent->left_ == node ? parent->left_ : parent->right_) = child;
+			updatePath(parent);
+		}
+
+		AMS<NodeType>::memoryManager_->releaseMemory(node);
+	}
+
+	template<typename DataType, size_t N>
+	bool RopeSequence<DataType, N>::adoptNodes(RopeSequence& other, const NodeType* subtree)
+	{
+		return AMS<NodeType>::memoryManager_->adoptBlocks(*other.memoryManager_, nodeCountOf(subtree));
+	}
+
+	template<typename DataType, size_t N>
+	void RopeSequence<DataType, N>::setRoot(NodeType* root)
+	{
+		root_ = root;
+		if (root_ != nullptr)
+		{
+			root_->parent_ = nullptr;
+		}
+	}
+
+	template<typename DataType, size_t N>
+	RopeSequence<DataType, N>::RopeSequenceIterator::RopeSequenceIterator(NodeType* node, size_t position) :
+		node_(node),
+		position_(position)
+	{
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::RopeSequenceIterator::operator++() -> RopeSequenceIterator&
+	{
+		if (++position_ == node_->count_)
+		{
+			node_ = nextNode(node_);
+			position_ = 0;
+		}
+		return *this;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::RopeSequenceIterator::operator++(int) -> RopeSequenceIterator
+	{
+		RopeSequenceIterator tmp(*this);
+		operator++();
+		return tmp;
+	}
+
+	template<typename DataType, size_t N>
+	bool RopeSequence<DataType, N>::RopeSequenceIterator::operator==(const RopeSequenceIterator& other) const
+	{
+		return node_ == other.node_ && position_ == other.position_;
+	}
+
+	template<typename DataType, size_t N>
+	bool RopeSequence<DataType, N>::RopeSequenceIterator::operator!=(const RopeSequenceIterator& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename DataType, size_t N>
+	DataType& RopeSequence<DataType, N>::RopeSequenceIterator::operator*()
+	{
+		return node_->blocks_[position_].data_;
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::begin() -> IteratorType
+	{
+		return RopeSequenceIterator(root_ != nullptr ? leftmost(root_) : nullptr, 0);
+	}
+
+	template<typename DataType, size_t N>
+	auto RopeSequence<DataType, N>::end() -> IteratorType
+	{
+		return RopeSequenceIterator(nullptr, 0);
+	}
+
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <libds/amt/abstract_memory_type.h>
+#include <iterator>
+#include <stdexcept>
 
 namespace ds::amt {
 
@@ -33,20 +35,120 @@ namespace ds::amt {
 		virtual void processAllBlocksBackward(std::function<void(BlockType*)> operation) const;
 		virtual void processBlocksForward(BlockType* block, std::function<void(BlockType*)> operation) const;
 		virtual void processBlocksBackward(BlockType* block, std::function<void(BlockType*)> operation) const;
-		BlockType* findBlockWithProperty(std::function<bool(BlockType*)> predicate) const;
+		virtual BlockType* findBlockWithProperty(std::function<bool(BlockType*)> predicate) const;
 		BlockType* findPreviousToBlockWithProperty(std::function<bool(BlockType*)> predicate) const;
+
+		/**
+		 * @brief Inserts @p count blocks in front of the block at @p index and returns
+		 * the first of them, nullptr if @p count is zero. By default blocks are inserted
+		 * one by one, sequences override it to make room for all of them at once.
+		 */
+		virtual BlockType* insertBlocks(size_t index, size_t count);
+
+		/**
+		 * @brief Removes @p count blocks starting with the block at @p index.
+		 */
+		virtual void removeRange(size_t index, size_t count);
+
+		/**
+		 * @brief Inserts blocks with copies of elements from [@p first, @p last) in front of the block at @p index.
+		 */
+		template<typename Iterator>
+		void insertRange(size_t index, Iterator first, Iterator last);
+
+		/**
+		 * @brief Inserts @p count blocks behind the last block and returns the first of them.
+		 */
+		BlockType* appendN(size_t count);
+
+		/**
+		 * @brief Calls @p operation on all blocks from the first one. Any callable
+		 * is accepted, so unlike processAllBlocksForward the call can be inlined.
+		 */
+		template<typename Operation>
+		void forEach(Operation&& operation) const;
+
+		/**
+		 * @brief Calls @p operation on all blocks from the last one.
+		 */
+		template<typename Operation>
+		void forEachBackward(Operation&& operation) const;
+
+		/**
+		 * @brief Returns the first block satisfying @p predicate or nullptr.
+		 */
+		template<typename Predicate>
+		BlockType* findBlock(Predicate&& predicate) const;
+	};
+
+	//----------
+
+	/**
+	 * @brief Calls operations of a sequence of type SequenceType without virtual dispatch.
+	 * Calls are qualified by SequenceType, so they are bound at compile time and can be inlined.
+	 * The dynamic type of the wrapped sequence has to be exactly SequenceType.
+	 */
+	template<typename SequenceType>
+	class StaticSequence
+	{
+	public:
+		using BlockType = typename SequenceType::BlockType;
+		using IteratorType = typename SequenceType::IteratorType;
+
+		explicit StaticSequence(SequenceType* sequence);
+
+		SequenceType* get() const;
+
+		size_t size() const;
+		bool isEmpty() const;
+		size_t calculateIndex(BlockType& block) const;
+
+		BlockType* accessFirst() const;
+		BlockType* accessLast() const;
+		BlockType* access(size_t index) const;
+		BlockType* accessNext(const BlockType& block) const;
+		BlockType* accessPrevious(const BlockType& block) const;
+
+		BlockType& insertFirst() const;
+		BlockType& insertLast() const;
+		BlockType& insert(size_t index) const;
+		BlockType& insertAfter(BlockType& block) const;
+		BlockType& insertBefore(BlockType& block) const;
+
+		void removeFirst() const;
+		void removeLast() const;
+		void remove(size_t index) const;
+		void removeNext(const BlockType& block) const;
+		void removePrevious(const BlockType& block) const;
+
+		BlockType* insertBlocks(size_t index, size_t count) const;
+		void removeRange(size_t index, size_t count) const;
+		template<typename Iterator>
+		void insertRange(size_t index, Iterator first, Iterator last) const;
+		BlockType* appendN(size_t count) const;
+
+		template<typename Operation>
+		void forEach(Operation&& operation) const;
+		template<typename Predicate>
+		BlockType* findBlock(Predicate&& predicate) const;
+
+		IteratorType begin() const;
+		IteratorType end() const;
+
+	private:
+		SequenceType* sequence_;
 	};
 
 	template<typename BlockType>
 	void Sequence<BlockType>::processAllBlocksForward(std::function<void(BlockType*)> operation) const
 	{
-		processBlocksForward(accessFirst(), operation);
+		this->forEach(operation);
 	}
 
 	template<typename BlockType>
 	void Sequence<BlockType>::processAllBlocksBackward(std::function<void(BlockType*)> operation) const
 	{
-		processBlocksBackward(accessLast(), operation);
+		this->forEachBackward(operation);
 	}
 
 	template<typename BlockType>
@@ -72,14 +174,7 @@ namespace ds::amt {
 	template<typename BlockType>
 	BlockType* Sequence<BlockType>::findBlockWithProperty(std::function<bool(BlockType*)> predicate) const
 	{
-		BlockType* block = accessFirst();
-
-		while (block != nullptr && !predicate(block))
-		{
-			block = accessNext(*block);
-		}
-
-		return block;
+		return this->findBlock(predicate);
 	}
 
 	template<typename BlockType>
@@ -106,4 +201,278 @@ namespace ds::amt {
 		}
 	}
 
+	template<typename BlockType>
+	BlockType* Sequence<BlockType>::insertBlocks(size_t index, size_t count)
+	{
+		if (index > this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			this->insert(index + i);
+		}
+
+		return count > 0 ? this->access(index) : nullptr;
+	}
+
+	template<typename BlockType>
+	void Sequence<BlockType>::removeRange(size_t index, size_t count)
+	{
+		if (index > this->size() || count > this->size() - index)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			this->remove(index);
+		}
+	}
+
+	template<typename BlockType>
+	template<typename Iterator>
+	void Sequence<BlockType>::insertRange(size_t index, Iterator first, Iterator last)
+	{
+		BlockType* block = this->insertBlocks(index, static_cast<size_t>(std::distance(first, last)));
+		for (; first != last; ++first)
+		{
+			block->data_ = *first;
+			block = this->accessNext(*block);
+		}
+	}
+
+	template<typename BlockType>
+	BlockType* Sequence<BlockType>::appendN(size_t count)
+	{
+		return this->insertBlocks(this->size(), count);
+	}
+
+	template<typename BlockType>
+	template<typename Operation>
+	void Sequence<BlockType>::forEach(Operation&& operation) const
+	{
+		BlockType* block = accessFirst();
+		while (block != nullptr)
+		{
+			operation(block);
+			block = accessNext(*block);
+		}
+	}
+
+	template<typename BlockType>
+	template<typename Operation>
+	void Sequence<BlockType>::forEachBackward(Operation&& operation) const
+	{
+		BlockType* block = accessLast();
+		while (block != nullptr)
+		{
+			operation(block);
+			block = accessPrevious(*block);
+		}
+	}
+
+	template<typename BlockType>
+	template<typename Predicate>
+	BlockType* Sequence<BlockType>::findBlock(Predicate&& predicate) const
+	{
+		BlockType* block = accessFirst();
+
+		while (block != nullptr && !predicate(block))
+		{
+			block = accessNext(*block);
+		}
+
+		return block;
+	}
+
+	template<typename SequenceType>
+	StaticSequence<SequenceType>::StaticSequence(SequenceType* sequence) :
+		sequence_(sequence)
+	{
+	}
+
+	template<typename SequenceType>
+	SequenceType* StaticSequence<SequenceType>::get() const
+	{
+		return sequence_;
+	}
+
+	template<typename SequenceType>
+	size_t StaticSequence<SequenceType>::size() const
+	{
+		return sequence_->SequenceType::size();
+	}
+
+	template<typename SequenceType>
+	bool StaticSequence<SequenceType>::isEmpty() const
+	{
+		return this->size() == 0;
+	}
+
+	template<typename SequenceType>
+	size_t StaticSequence<SequenceType>::calculateIndex(BlockType& block) const
+	{
+		return sequence_->SequenceType::calculateIndex(block);
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::accessFirst() const -> BlockType*
+	{
+		return sequence_->SequenceType::accessFirst();
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::accessLast() const -> BlockType*
+	{
+		return sequence_->SequenceType::accessLast();
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::access(size_t index) const -> BlockType*
+	{
+		return sequence_->SequenceType::access(index);
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::accessNext(const BlockType& block) const -> BlockType*
+	{
+		return sequence_->SequenceType::accessNext(block);
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::accessPrevious(const BlockType& block) const -> BlockType*
+	{
+		return sequence_->SequenceType::accessPrevious(block);
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::insertFirst() const -> BlockType&
+	{
+		return sequence_->SequenceType::insertFirst();
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::insertLast() const -> BlockType&
+	{
+		return sequence_->SequenceType::insertLast();
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::insert(size_t index) const -> BlockType&
+	{
+		return sequence_->SequenceType::insert(index);
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::insertAfter(BlockType& block) const -> BlockType&
+	{
+		return sequence_->SequenceType::insertAfter(block);
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::insertBefore(BlockType& block) const -> BlockType&
+	{
+		return sequence_->SequenceType::insertBefore(block);
+	}
+
+	template<typename SequenceType>
+	void StaticSequence<SequenceType>::removeFirst() const
+	{
+		sequence_->SequenceType::removeFirst();
+	}
+
+	template<typename SequenceType>
+	void StaticSequence<SequenceType>::removeLast() const
+	{
+		sequence_->SequenceType::removeLast();
+	}
+
+	template<typename SequenceType>
+	void StaticSequence<SequenceType>::remove(size_t index) const
+	{
+		sequence_->SequenceType::remove(index);
+	}
+
+	template<typename SequenceType>
+	void StaticSequence<SequenceType>::removeNext(const BlockType& block) const
+	{
+		sequence_->SequenceType::removeNext(block);
+	}
+
+	template<typename SequenceType>
+	void StaticSequence<SequenceType>::removePrevious(const BlockType& block) const
+	{
+		sequence_->SequenceType::removePrevious(block);
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::insertBlocks(size_t index, size_t count) const -> BlockType*
+	{
+		return sequence_->SequenceType::insertBlocks(index, count);
+	}
+
+	template<typename SequenceType>
+	void StaticSequence<SequenceType>::removeRange(size_t index, size_t count) const
+	{
+		sequence_->SequenceType::removeRange(index, count);
+	}
+
+	template<typename SequenceType>
+	template<typename Iterator>
+	void StaticSequence<SequenceType>::insertRange(size_t index, Iterator first, Iterator last) const
+	{
+		BlockType* block = this->insertBlocks(index, static_cast<size_t>(std::distance(first, last)));
+		for (; first != last; ++first)
+		{
+			block->data_ = *first;
+			block = this->accessNext(*block);
+		}
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::appendN(size_t count) const -> BlockType*
+	{
+		return this->insertBlocks(this->size(), count);
+	}
+
+	template<typename SequenceType>
+	template<typename Operation>
+	void StaticSequence<SequenceType>::forEach(Operation&& operation) const
+	{
+		BlockType* block = this->accessFirst();
+		while (block != nullptr)
+		{
+			operation(block);
+			block = this->accessNext(*block);
+		}
+	}
+
+	template<typename SequenceType>
+	template<typename Predicate>
+	auto StaticSequence<SequenceType>::findBlock(Predicate&& predicate) const -> BlockType*
+	{
+		BlockType* block = this->accessFirst();
+
+		while (block != nullptr && !predicate(block))
+		{
+			block = this->accessNext(*block);
+		}
+
+		return block;
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::begin() const -> IteratorType
+	{
+		return sequence_->begin();
+	}
+
+	template<typename SequenceType>
+	auto StaticSequence<SequenceType>::end() const -> IteratorType
+	{
+		return sequence_->end();
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,556 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/sequence.h>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace ds::amt {
+
+	/**
+	 * @brief Block of a skip list sequence with a tower of forward links.
+	 * Span of a link is the number of positions it skips, back_ is the block
+	 * whose link at the top level of this block points to it.
+	 */
+	template<typename DataType>
+	struct SkipListSequenceBlock :
+		public MemoryBlock<DataType>
+	{
+		struct Link
+		{
+			Link() : next_(nullptr), span_(0) {}
+
+			SkipListSequenceBlock<DataType>* next_;
+			size_t span_;
+		};
+
+		SkipListSequenceBlock() : previous_(nullptr), back_(nullptr) {}
+
+		SkipListSequenceBlock<DataType>* previous_;
+		SkipListSequenceBlock<DataType>* back_;
+		std::vector<Link> links_;
+	};
+
+	//----------
+
+	/**
+	 * @brief Indexable skip list, access, insert and remove by index and
+	 * calculateIndex take O(log n) expected time.
+	 * calculateIndex climbs the links of the block, so the block has to be
+	 * a live skip list block; a block of another list gives INVALID_INDEX.
+	 */
+	template<typename DataType>
+	class SkipListSequence :
+		public Sequence<SkipListSequenceBlock<DataType>>,
+		public ExplicitAMS<SkipListSequenceBlock<DataType>>
+	{
+	public:
+		using BlockType = SkipListSequenceBlock<DataType>;
+
+		SkipListSequence();
+		SkipListSequence(mm::MemoryManager<BlockType>* memoryManager);
+		SkipListSequence(const SkipListSequence& other);
+		~SkipListSequence() override;
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		bool equals(const AMT& other) override;
+
+		size_t calculateIndex(BlockType& block) override;
+
+		BlockType* accessFirst() const override;
+		BlockType* accessLast() const override;
+		BlockType* access(size_t index) const override;
+		BlockType* accessNext(const BlockType& block) const override;
+		BlockType* accessPrevious(const BlockType& block) const override;
+
+		BlockType& insertFirst() override;
+		BlockType& insertLast() override;
+		BlockType& insert(size_t index) override;
+		BlockType& insertAfter(BlockType& block) override;
+		BlockType& insertBefore(BlockType& block) override;
+
+		void removeFirst() override;
+		void removeLast() override;
+		void remove(size_t index) override;
+		void removeNext(const BlockType& block) override;
+		void removePrevious(const BlockType& block) override;
+
+		size_t getHeight() const;
+
+		static const size_t MAX_HEIGHT = 32;
+
+	private:
+		using Link = typename BlockType::Link;
+
+		Link& linkOf(BlockType* block, size_t level);
+		const Link& linkOf(const BlockType* block, size_t level) const;
+		size_t indexOf(const BlockType& block) const;
+		size_t randomHeight();
+		void findPredecessors(size_t index, BlockType** predecessors, size_t* ranks);
+
+	private:
+		Link head_[MAX_HEIGHT];
+		size_t height_;
+		BlockType* last_;
+		std::minstd_rand random_;
+
+	public:
+		class SkipListSequenceIterator
+		{
+		public:
+			explicit SkipListSequenceIterator(BlockType* position);
+			SkipListSequenceIterator& operator++();
+			SkipListSequenceIterator operator++(int);
+			bool operator==(const SkipListSequenceIterator& other) const;
+			bool operator!=(const SkipListSequenceIterator& other) const;
+			DataType& operator*();
+
+		private:
+			BlockType* position_;
+		};
+
+		using IteratorType = SkipListSequenceIterator;
+
+		IteratorType begin();
+		IteratorType end();
+	};
+
+	template<typename DataType>
+	using SkipLS = SkipListSequence<DataType>;
+
+	//----------
+
+	template<typename DataType>
+	SkipListSequence<DataType>::SkipListSequence() :
+		height_(1),
+		last_(nullptr)
+	{
+	}
+
+	template<typename DataType>
+	SkipListSequence<DataType>::SkipListSequence(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitAMS<BlockType>(memoryManager),
+		height_(1),
+		last_(nullptr)
+	{
+	}
+
+	template<typename DataType>
+	SkipListSequence<DataType>::SkipListSequence(const SkipListSequence& other) :
+		SkipListSequence()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType>
+	SkipListSequence<DataType>::~SkipListSequence()
+	{
+		SkipListSequence<DataType>::clear();
+	}
+
+	template<typename DataType>
+	AMT& SkipListSequence<DataType>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+
+			const SkipListSequence<DataType>& otherSequence = dynamic_cast<const SkipListSequence<DataType>&>(other);
+			for (BlockType* block = otherSequence.accessFirst(); block != nullptr; block = otherSequence.accessNext(*block))
+			{
+				this->insertLast().data_ = block->data_;
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename DataType>
+	void SkipListSequence<DataType>::clear()
+	{
+		BlockType* block = head_[0].next_;
+		while (block != nullptr)
+		{
+			BlockType* next = block->links_[0].next_;
+			AMS<BlockType>::memoryManager_->releaseMemory(block);
+			block = next;
+		}
+
+		for (Link& link : head_)
+		{
+			link = Link();
+		}
+		height_ = 1;
+		last_ = nullptr;
+	}
+
+	template<typename DataType>
+	bool SkipListSequence<DataType>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		if (this->size() != other.size())
+		{
+			return false;
+		}
+
+		const SkipListSequence<DataType>* otherSequence = dynamic_cast<const SkipListSequence<DataType>*>(&other);
+		if (otherSequence == nullptr)
+		{
+			return false;
+		}
+
+		BlockType* myCurrent = this->accessFirst();
+		BlockType* otherCurrent = otherSequence->accessFirst();
+
+		while (myCurrent != nullptr)
+		{
+			if (!(myCurrent->data_ == otherCurrent->data_))
+			{
+				return false;
+			}
+
+			myCurrent = myCurrent->links_[0].next_;
+			otherCurrent = otherCurrent->links_[0].next_;
+		}
+
+		return true;
+	}
+
+	template<typename DataType>
+	size_t SkipListSequence<DataType>::calculateIndex(BlockType& block)
+	{
+		// The climb from a block of this list ends at a block linked from head_.
+		const BlockType* top = &block;
+		while (top->back_ != nullptr)
+		{
+			top = top->back_;
+		}
+
+		return head_[top->links_.size() - 1].next_ == top ? this->indexOf(block) : INVALID_INDEX;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::accessFirst() const -> BlockType*
+	{
+		return head_[0].next_;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::accessLast() const -> BlockType*
+	{
+		return last_;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::access(size_t index) const -> BlockType*
+	{
+		if (index >= this->size())
+		{
+			return nullptr;
+		}
+
+		// Rank of the head is 0, rank of the block at index i is i + 1.
+		const BlockType* block = nullptr;
+		size_t rank = 0;
+		for (size_t level = height_; level > 0; --level)
+		{
+			const Link* link = &this->linkOf(block, level - 1);
+			while (link->next_ != nullptr && rank + link->span_ <= index + 1)
+			{
+				rank += link->span_;
+				block = link->next_;
+				link = &this->linkOf(block, level - 1);
+			}
+
+			if (rank == index + 1)
+			{
+				break;
+			}
+		}
+
+		return const_cast<BlockType*>(block);
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::accessNext(const BlockType& block) const -> BlockType*
+	{
+		return block.links_[0].next_;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::accessPrevious(const BlockType& block) const -> BlockType*
+	{
+		return block.previous_;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::insertFirst() -> BlockType&
+	{
+		return this->insert(0);
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::insertLast() -> BlockType&
+	{
+		return this->insert(this->size());
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::insert(size_t index) -> BlockType&
+	{
+		if (index > this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		BlockType* predecessors[MAX_HEIGHT];
+		size_t ranks[MAX_HEIGHT];
+		this->findPredecessors(index, predecessors, ranks);
+
+		const size_t height = this->randomHeight();
+		for (size_t level = height_; level < height; ++level)
+		{
+			predecessors[level] = nullptr;
+			ranks[level] = 0;
+			head_[level].next_ = nullptr;
+			head_[level].span_ = this->size();
+		}
+		if (height > height_)
+		{
+			height_ = height;
+		}
+
+		BlockType* newBlock = AMS<BlockType>::memoryManager_->allocateMemory();
+		newBlock->links_.resize(height);
+
+		for (size_t level = 0; level < height; ++level)
+		{
+			Link& link = this->linkOf(predecessors[level], level);
+			newBlock->links_[level].next_ = link.next_;
+			newBlock->links_[level].span_ = link.span_ - (ranks[0] - ranks[level]);
+			link.next_ = newBlock;
+			link.span_ = ranks[0] - ranks[level] + 1;
+
+			BlockType* next = newBlock->links_[level].next_;
+			if (next != nullptr && next->links_.size() == level + 1)
+			{
+				next->back_ = newBlock;
+			}
+		}
+		for (size_t level = height; level < height_; ++level)
+		{
+			++this->linkOf(predecessors[level], level).span_;
+		}
+
+		newBlock->back_ = predecessors[height - 1];
+		newBlock->previous_ = predecessors[0];
+		BlockType* next = newBlock->links_[0].next_;
+		(next != nullptr ? next->previous_ : last_) = newBlock;
+
+		return *newBlock;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::insertAfter(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->indexOf(block) + 1);
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::insertBefore(BlockType& block) -> BlockType&
+	{
+		return this->insert(this->indexOf(block));
+	}
+
+	template<typename DataType>
+	void SkipListSequence<DataType>::removeFirst()
+	{
+		this->remove(0);
+	}
+
+	template<typename DataType>
+	void SkipListSequence<DataType>::removeLast()
+	{
+		this->remove(this->size() - 1);
+	}
+
+	template<typename DataType>
+	void SkipListSequence<DataType>::remove(size_t index)
+	{
+		if (index >= this->size())
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		BlockType* predecessors[MAX_HEIGHT];
+		size_t ranks[MAX_HEIGHT];
+		this->findPredecessors(index, predecessors, ranks);
+
+		BlockType* removed = this->linkOf(predecessors[0], 0).next_;
+		for (size_t level = 0; level < height_; ++level)
+		{
+			Link& link = this->linkOf(predecessors[level], level);
+			if (link.next_ == removed)
+			{
+				link.next_ = removed->links_[level].next_;
+				link.span_ += removed->links_[level].span_ - 1;
+
+				BlockType* next = link.next_;
+				if (next != nullptr && next->links_.size() == level + 1)
+				{
+					next->back_ = predecessors[level];
+				}
+			}
+			else
+			{
+				--link.span_;
+			}
+		}
+
+		BlockType* next = removed->links_[0].next_;
+		(next != nullptr ? next->previous_ : last_) = removed->previous_;
+
+		while (height_ > 1 && head_[height_ - 1].next_ == nullptr)
+		{
+			--height_;
+		}
+
+		AMS<BlockType>::memoryManager_->releaseMemory(removed);
+	}
+
+	template<typename DataType>
+	void SkipListSequence<DataType>::removeNext(const BlockType& block)
+	{
+		this->remove(this->indexOf(block) + 1);
+	}
+
+	template<typename DataType>
+	void SkipListSequence<DataType>::removePrevious(const BlockType& block)
+	{
+		this->remove(this->indexOf(block) - 1);
+	}
+
+	template<typename DataType>
+	size_t SkipListSequence<DataType>::getHeight() const
+	{
+		return height_;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::linkOf(BlockType* block, size_t level) -> Link&
+	{
+		return block != nullptr ? block->links_[level] : head_[level];
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::linkOf(const BlockType* block, size_t level) const -> const Link&
+	{
+		return block != nullptr ? block->links_[level] : head_[level];
+	}
+
+	template<typename DataType>
+	size_t SkipListSequence<DataType>::indexOf(const BlockType& block) const
+	{
+		// Climbs back along the top links, which mirrors the search path.
+		size_t rank = 0;
+		const BlockType* current = &block;
+		while (current != nullptr)
+		{
+			const BlockType* back = current->back_;
+			rank += this->linkOf(back, current->links_.size() - 1).span_;
+			current = back;
+		}
+
+		return rank - 1;
+	}
+
+	template<typename DataType>
+	size_t SkipListSequence<DataType>::randomHeight()
+	{
+		size_t height = 1;
+		while (height < MAX_HEIGHT && (random_() & 3) == 0)
+		{
+			++height;
+		}
+
+		return height;
+	}
+
+	template<typename DataType>
+	void SkipListSequence<DataType>::findPredecessors(size_t index, BlockType** predecessors, size_t* ranks)
+	{
+		BlockType* block = nullptr;
+		size_t rank = 0;
+		for (size_t level = height_; level > 0; --level)
+		{
+			Link* link = &this->linkOf(block, level - 1);
+			while (link->next_ != nullptr && rank + link->span_ <= index)
+			{
+				rank += link->span_;
+				block = link->next_;
+				link = &this->linkOf(block, level - 1);
+			}
+
+			predecessors[level - 1] = block;
+			ranks[level - 1] = rank;
+		}
+	}
+
+	template<typename DataType>
+	SkipListSequence<DataType>::SkipListSequenceIterator::SkipListSequenceIterator(BlockType* position) :
+		position_(position)
+	{
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::SkipListSequenceIterator::operator++() -> SkipListSequenceIterator&
+	{
+		position_ = position_->links_[0].next_;
+		return *this;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::SkipListSequenceIterator::operator++(int) -> SkipListSequenceIterator
+	{
+		SkipListSequenceIterator tmp(*this);
+		operator++();
+		return tmp;
+	}
+
+	template<typename DataType>
+	bool SkipListSequence<DataType>::SkipListSequenceIterator::operator==(const SkipListSequenceIterator& other) const
+	{
+		return position_ == other.position_;
+	}
+
+	template<typename DataType>
+	bool SkipListSequence<DataType>::SkipListSequenceIterator::operator!=(const SkipListSequenceIterator& other) const
+	{
+		return position_ != other.position_;
+	}
+
+	template<typename DataType>
+	DataType& SkipListSequence<DataType>::SkipListSequenceIterator::operator*()
+	{
+		return position_->data_;
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::begin() -> IteratorType
+	{
+		return SkipListSequenceIterator(head_[0].next_);
+	}
+
+	template<typename DataType>
+	auto SkipListSequence<DataType>::end() -> IteratorType
+	{
+		return SkipListSequenceIterator(nullptr);
+	}
+
+}
@@ -0,0 +1,630 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/sequence.h>
+#include <utility>
+
+namespace ds::amt {
+
+	template<typename DataType, size_t N>
+	struct UnrolledLinkedSequenceNode;
+
+	template<typename DataType, size_t N>
+	struct UnrolledLinkedSequenceNodeData
+	{
+		UnrolledLinkedSequenceNodeData() : next_(nullptr), previous_(nullptr), count_(0) {}
+
+		UnrolledLinkedSequenceNode<DataType, N>* next_;
+		UnrolledLinkedSequenceNode<DataType, N>* previous_;
+		size_t count_;
+		MemoryBlock<DataType> blocks_[N];
+	};
+
+	/**
+	 * @brief Node holding up to N consecutive blocks of an unrolled linked sequence.
+	 */
+	template<typename DataType, size_t N>
+	struct UnrolledLinkedSequenceNode :
+		public details::AlignedNode<UnrolledLinkedSequenceNodeData<DataType, N>>
+	{
+	};
+
+	//----------
+
+	/**
+	 * @brief Doubly linked list of nodes each holding up to N blocks contiguously.
+	 *
+	 * A full node is split in halves on insert, a node less than half full is
+	 * merged with its neighbour on remove if both fit into one node. Insert and
+	 * remove move blocks within a node, so references to blocks of the modified
+	 * node and its neighbours are not stable.
+	 */
+	template<typename DataType, size_t N>
+	class UnrolledLinkedSequence :
+		public Sequence<MemoryBlock<DataType>>,
+		public ExplicitAMS<UnrolledLinkedSequenceNode<DataType, N>>
+	{
+		static_assert(N >= 2, "Node has to hold at least two blocks.");
+
+	public:
+		using BlockType = MemoryBlock<DataType>;
+		using NodeType = UnrolledLinkedSequenceNode<DataType, N>;
+
+		UnrolledLinkedSequence();
+		UnrolledLinkedSequence(mm::MemoryManager<NodeType>* memoryManager);
+		UnrolledLinkedSequence(const UnrolledLinkedSequence& other);
+		~UnrolledLinkedSequence() override;
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		size_t size() const override;
+		bool equals(const AMT& other) override;
+
+		size_t calculateIndex(BlockType& block) override;
+
+		BlockType* accessFirst() const override;
+		BlockType* accessLast() const override;
+		BlockType* access(size_t index) const override;
+		BlockType* accessNext(const BlockType& block) const override;
+		BlockType* accessPrevious(const BlockType& block) const override;
+
+		BlockType& insertFirst() override;
+		BlockType& insertLast() override;
+		BlockType& insert(size_t index) override;
+		BlockType& insertAfter(BlockType& block) override;
+		BlockType& insertBefore(BlockType& block) override;
+
+		void removeFirst() override;
+		void removeLast() override;
+		void remove(size_t index) override;
+		void removeNext(const BlockType& block) override;
+		void removePrevious(const BlockType& block) override;
+
+		void processAllBlocksForward(std::function<void(BlockType*)> operation) const override;
+		void processAllBlocksBackward(std::function<void(BlockType*)> operation) const override;
+
+		/**
+		 * @brief Calls @p operation on all blocks, node by node.
+		 */
+		template<typename Operation>
+		void forEach(Operation&& operation) const;
+		template<typename Operation>
+		void forEachBackward(Operation&& operation) const;
+
+		size_t getNodeCount() const;
+
+		static const size_t NODE_CAPACITY = N;
+
+	private:
+		NodeType* findNode(size_t& index) const;
+		NodeType* insertNodeAfter(NodeType* node);
+		void releaseNode(NodeType* node);
+		BlockType& insertAt(NodeType* node, size_t position);
+		void removeAt(NodeType* node, size_t position);
+		void mergeNext(NodeType* node);
+
+	private:
+		NodeType* first_;
+		NodeType* last_;
+		size_t size_;
+
+	public:
+		class UnrolledLinkedSequenceIterator
+		{
+		public:
+			UnrolledLinkedSequenceIterator(NodeType* node, size_t position);
+			UnrolledLinkedSequenceIterator& operator++();
+			UnrolledLinkedSequenceIterator operator++(int);
+			bool operator==(const UnrolledLinkedSequenceIterator& other) const;
+			bool operator!=(const UnrolledLinkedSequenceIterator& other) const;
+			DataType& operator*();
+
+		private:
+			NodeType* node_;
+			size_t position_;
+		};
+
+		using IteratorType = UnrolledLinkedSequenceIterator;
+
+		IteratorType begin();
+		IteratorType end();
+	};
+
+	template<typename DataType, size_t N = 32>
+	using UnrolledLS = UnrolledLinkedSequence<DataType, N>;
+
+	//----------
+
+	template<typename DataType, size_t N>
+	UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequence() :
+		first_(nullptr),
+		last_(nullptr),
+		size_(0)
+	{
+	}
+
+	template<typename DataType, size_t N>
+	UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequence(mm::MemoryManager<NodeType>* memoryManager) :
+		ExplicitAMS<NodeType>(memoryManager),
+		first_(nullptr),
+		last_(nullptr),
+		size_(0)
+	{
+	}
+
+	template<typename DataType, size_t N>
+	UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequence(const UnrolledLinkedSequence& other) :
+		UnrolledLinkedSequence()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType, size_t N>
+	UnrolledLinkedSequence<DataType, N>::~UnrolledLinkedSequence()
+	{
+		UnrolledLinkedSequence<DataType, N>::clear();
+	}
+
+	template<typename DataType, size_t N>
+	AMT& UnrolledLinkedSequence<DataType, N>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+
+			const UnrolledLinkedSequence<DataType, N>& otherSequence = dynamic_cast<const UnrolledLinkedSequence<DataType, N>&>(other);
+			otherSequence.forEach([this](const BlockType* block)
+				{
+					this->insertLast().data_ = block->data_;
+				});
+		}
+
+		return *this;
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::clear()
+	{
+		if (!this->tryReleaseAllBlocks())
+		{
+			while (first_ != nullptr)
+			{
+				NodeType* next = first_->next_;
+				AMS<NodeType>::memoryManager_->releaseMemory(first_);
+				first_ = next;
+			}
+		}
+
+		first_ = nullptr;
+		last_ = nullptr;
+		size_ = 0;
+	}
+
+	template<typename DataType, size_t N>
+	size_t UnrolledLinkedSequence<DataType, N>::size() const
+	{
+		return size_;
+	}
+
+	template<typename DataType, size_t N>
+	bool UnrolledLinkedSequence<DataType, N>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		if (this->size() != other.size())
+		{
+			return false;
+		}
+
+		const UnrolledLinkedSequence<DataType, N>* otherSequence = dynamic_cast<const UnrolledLinkedSequence<DataType, N>*>(&other);
+		if (otherSequence == nullptr)
+		{
+			return false;
+		}
+
+		BlockType* myCurrent = this->accessFirst();
+		BlockType* otherCurrent = otherSequence->accessFirst();
+
+		while (myCurrent != nullptr)
+		{
+			if (!(myCurrent->data_ == otherCurrent->data_))
+			{
+				return false;
+			}
+
+			myCurrent = this->accessNext(*myCurrent);
+			otherCurrent = otherSequence->accessNext(*otherCurrent);
+		}
+
+		return true;
+	}
+
+	template<typename DataType, size_t N>
+	size_t UnrolledLinkedSequence<DataType, N>::calculateIndex(BlockType& block)
+	{
+		NodeType* node = details::nodeOfBlock<NodeType>(block);
+		size_t result = 0;
+
+		for (NodeType* current = first_; current != nullptr; current = current->next_)
+		{
+			if (current == node)
+			{
+				const size_t position = details::indexInNode(node, block);
+				return position < node->count_ ? result + position : INVALID_INDEX;
+			}
+			result += current->count_;
+		}
+
+		return INVALID_INDEX;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::accessFirst() const -> BlockType*
+	{
+		return first_ != nullptr ? &first_->blocks_[0] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::accessLast() const -> BlockType*
+	{
+		return last_ != nullptr ? &last_->blocks_[last_->count_ - 1] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::access(size_t index) const -> BlockType*
+	{
+		NodeType* node = this->findNode(index);
+		return node != nullptr ? &node->blocks_[index] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::accessNext(const BlockType& block) const -> BlockType*
+	{
+		NodeType* node = details::nodeOfBlock<NodeType>(block);
+		const size_t position = details::indexInNode(node, block) + 1;
+
+		if (position < node->count_)
+		{
+			return &node->blocks_[position];
+		}
+
+		return node->next_ != nullptr ? &node->next_->blocks_[0] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::accessPrevious(const BlockType& block) const -> BlockType*
+	{
+		NodeType* node = details::nodeOfBlock<NodeType>(block);
+		const size_t position = details::indexInNode(node, block);
+
+		if (position > 0)
+		{
+			return &node->blocks_[position - 1];
+		}
+
+		return node->previous_ != nullptr ? &node->previous_->blocks_[node->previous_->count_ - 1] : nullptr;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::insertFirst() -> BlockType&
+	{
+		if (first_ == nullptr)
+		{
+			this->insertNodeAfter(nullptr);
+		}
+
+		return this->insertAt(first_, 0);
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::insertLast() -> BlockType&
+	{
+		if (last_ == nullptr)
+		{
+			this->insertNodeAfter(nullptr);
+		}
+
+		return this->insertAt(last_, last_->count_);
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::insert(size_t index) -> BlockType&
+	{
+		if (index == size_)
+		{
+			return this->insertLast();
+		}
+
+		NodeType* node = this->findNode(index);
+		if (node == nullptr)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		return this->insertAt(node, index);
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::insertAfter(BlockType& block) -> BlockType&
+	{
+		NodeType* node = details::nodeOfBlock<NodeType>(block);
+		return this->insertAt(node, details::indexInNode(node, block) + 1);
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::insertBefore(BlockType& block) -> BlockType&
+	{
+		NodeType* node = details::nodeOfBlock<NodeType>(block);
+		return this->insertAt(node, details::indexInNode(node, block));
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::removeFirst()
+	{
+		this->removeAt(first_, 0);
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::removeLast()
+	{
+		this->removeAt(last_, last_->count_ - 1);
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::remove(size_t index)
+	{
+		NodeType* node = this->findNode(index);
+		if (node == nullptr)
+		{
+			throw std::out_of_range("Invalid index!");
+		}
+
+		this->removeAt(node, index);
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::removeNext(const BlockType& block)
+	{
+		BlockType* next = this->accessNext(block);
+		NodeType* node = details::nodeOfBlock<NodeType>(*next);
+		this->removeAt(node, details::indexInNode(node, *next));
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::removePrevious(const BlockType& block)
+	{
+		BlockType* previous = this->accessPrevious(block);
+		NodeType* node = details::nodeOfBlock<NodeType>(*previous);
+		this->removeAt(node, details::indexInNode(node, *previous));
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::processAllBlocksForward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEach(operation);
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::processAllBlocksBackward(std::function<void(BlockType*)> operation) const
+	{
+		this->forEachBackward(operation);
+	}
+
+	template<typename DataType, size_t N>
+	template<typename Operation>
+	void UnrolledLinkedSequence<DataType, N>::forEach(Operation&& operation) const
+	{
+		for (NodeType* node = first_; node != nullptr; node = node->next_)
+		{
+			for (size_t i = 0; i < node->count_; ++i)
+			{
+				operation(&node->blocks_[i]);
+			}
+		}
+	}
+
+	template<typename DataType, size_t N>
+	template<typename Operation>
+	void UnrolledLinkedSequence<DataType, N>::forEachBackward(Operation&& operation) const
+	{
+		for (NodeType* node = last_; node != nullptr; node = node->previous_)
+		{
+			for (size_t i = node->count_; i > 0; --i)
+			{
+				operation(&node->blocks_[i - 1]);
+			}
+		}
+	}
+
+	template<typename DataType, size_t N>
+	size_t UnrolledLinkedSequence<DataType, N>::getNodeCount() const
+	{
+		return AMS<NodeType>::memoryManager_->getAllocatedBlockCount();
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::findNode(size_t& index) const -> NodeType*
+	{
+		if (index >= size_)
+		{
+			return nullptr;
+		}
+
+		if (index < size_ / 2)
+		{
+			NodeType* node = first_;
+			while (index >= node->count_)
+			{
+				index -= node->count_;
+				node = node->next_;
+			}
+			return node;
+		}
+
+		NodeType* node = last_;
+		size_t fromEnd = size_ - 1 - index;
+		while (fromEnd >= node->count_)
+		{
+			fromEnd -= node->count_;
+			node = node->previous_;
+		}
+		index = node->count_ - 1 - fromEnd;
+		return node;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::insertNodeAfter(NodeType* node) -> NodeType*
+	{
+		NodeType* newNode = AMS<NodeType>::memoryManager_->allocateMemory();
+		NodeType* next = node != nullptr ? node->next_ : first_;
+
+		newNode->previous_ = node;
+		newNode->next_ = next;
+		(node != nullptr ? node->next_ : first_) = newNode;
+		(next != nullptr ? next->previous_ : last_) = newNode;
+
+		return newNode;
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::releaseNode(NodeType* node)
+	{
+		(node->previous_ != nullptr ? node->previous_->next_ : first_) = node->next_;
+		(node->next_ != nullptr ? node->next_->previous_ : last_) = node->previous_;
+		AMS<NodeType>::memoryManager_->releaseMemory(node);
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::insertAt(NodeType* node, size_t position) -> BlockType&
+	{
+		if (node->count_ == N)
+		{
+			if (position == N)
+			{
+				// Appending behind a full node starts a new one, so filling the
+				// sequence from one end leaves full nodes behind.
+				node = this->insertNodeAfter(node);
+				position = 0;
+			}
+			else
+			{
+				NodeType* newNode = this->insertNodeAfter(node);
+				const size_t half = N / 2;
+				std::move(node->blocks_ + half, node->blocks_ + N, newNode->blocks_);
+				for (size_t i = half; i < N; ++i)
+				{
+					node->blocks_[i].data_ = DataType();
+				}
+				newNode->count_ = N - half;
+				node->count_ = half;
+
+				if (position > half)
+				{
+					node = newNode;
+					position -= half;
+				}
+			}
+		}
+
+		std::move_backward(node->blocks_ + position, node->blocks_ + node->count_, node->blocks_ + node->count_ + 1);
+		node->blocks_[position].data_ = DataType();
+		++node->count_;
+		++size_;
+
+		return node->blocks_[position];
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::removeAt(NodeType* node, size_t position)
+	{
+		std::move(node->blocks_ + position + 1, node->blocks_ + node->count_, node->blocks_ + position);
+		--node->count_;
+		node->blocks_[node->count_].data_ = DataType();
+		--size_;
+
+		if (node->count_ == 0)
+		{
+			this->releaseNode(node);
+		}
+		else if (node->count_ < N / 2)
+		{
+			if (node->next_ != nullptr && node->count_ + node->next_->count_ <= N)
+			{
+				this->mergeNext(node);
+			}
+			else if (node->previous_ != nullptr && node->previous_->count_ + node->count_ <= N)
+			{
+				this->mergeNext(node->previous_);
+			}
+		}
+	}
+
+	template<typename DataType, size_t N>
+	void UnrolledLinkedSequence<DataType, N>::mergeNext(NodeType* node)
+	{
+		NodeType* next = node->next_;
+		std::move(next->blocks_, next->blocks_ + next->count_, node->blocks_ + node->count_);
+		node->count_ += next->count_;
+		this->releaseNode(next);
+	}
+
+	template<typename DataType, size_t N>
+	UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequenceIterator::UnrolledLinkedSequenceIterator(NodeType* node, size_t position) :
+		node_(node),
+		position_(position)
+	{
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequenceIterator::operator++() -> UnrolledLinkedSequenceIterator&
+	{
+		if (++position_ == node_->count_)
+		{
+			node_ = node_->next_;
+			position_ = 0;
+		}
+		return *this;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequenceIterator::operator++(int) -> UnrolledLinkedSequenceIterator
+	{
+		UnrolledLinkedSequenceIterator tmp(*this);
+		operator++();
+		return tmp;
+	}
+
+	template<typename DataType, size_t N>
+	bool UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequenceIterator::operator==(const UnrolledLinkedSequenceIterator& other) const
+	{
+		return node_ == other.node_ && position_ == other.position_;
+	}
+
+	template<typename DataType, size_t N>
+	bool UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequenceIterator::operator!=(const UnrolledLinkedSequenceIterator& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename DataType, size_t N>
+	DataType& UnrolledLinkedSequence<DataType, N>::UnrolledLinkedSequenceIterator::operator*()
+	{
+		return node_->blocks_[position_].data_;
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::begin() -> IteratorType
+	{
+		return UnrolledLinkedSequenceIterator(first_, 0);
+	}
+
+	template<typename DataType, size_t N>
+	auto UnrolledLinkedSequence<DataType, N>::end() -> IteratorType
+	{
+		return UnrolledLinkedSequenceIterator(nullptr, 0);
+	}
+
+}
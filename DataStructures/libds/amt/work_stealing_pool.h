@@ -0,0 +1,308 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ds::amt {
+
+	/**
+	 * @brief Pool of threads running fork-join tasks.
+	 *
+	 * Every worker keeps its own deque of tasks. A worker takes its newest task first,
+	 * so it continues depth-first in the subtree it has just split, and an idle worker
+	 * steals the oldest task of another worker, which is usually the biggest one.
+	 * Threads outside of the pool share one extra deque. A thread waiting for a group
+	 * of tasks runs other tasks in the meantime, so tasks may fork and wait recursively.
+	 */
+	class WorkStealingPool
+	{
+	public:
+		/**
+		 * @brief Tasks forked together, waited for by one call of wait.
+		 */
+		class TaskGroup
+		{
+		public:
+			TaskGroup();
+			TaskGroup(const TaskGroup& other) = delete;
+
+		private:
+			friend class WorkStealingPool;
+
+			std::atomic<size_t> pending_;
+			std::mutex errorMutex_;
+			std::exception_ptr error_;
+		};
+
+	public:
+		WorkStealingPool();
+		explicit WorkStealingPool(size_t threadCount);
+		WorkStealingPool(const WorkStealingPool& other) = delete;
+		~WorkStealingPool();
+
+		/**
+		 * @brief Returns pool with a thread for every hardware thread, created on first use.
+		 */
+		static WorkStealingPool& getShared();
+
+		size_t getThreadCount() const;
+
+		/**
+		 * @brief Returns true if there are enough queued tasks to keep all workers busy,
+		 * so forking another one would only add overhead.
+		 */
+		bool isSaturated() const;
+
+		/**
+		 * @brief Queues @p task as a member of @p group.
+		 */
+		template<typename Function>
+		void fork(TaskGroup& group, Function&& task);
+
+		/**
+		 * @brief Runs tasks until all tasks of @p group are finished.
+		 * Rethrows the first exception thrown by a task of the group.
+		 */
+		void wait(TaskGroup& group);
+
+	private:
+		struct Task
+		{
+			std::function<void()> run_;
+			TaskGroup* group_;
+		};
+
+		struct WorkerQueue
+		{
+			std::mutex mutex_;
+			std::deque<Task> tasks_;
+		};
+
+	private:
+		void push(Task task);
+		bool tryTakeTask(Task& task);
+		void execute(Task& task);
+		void runWorker(size_t index);
+		size_t currentQueue() const;
+
+	private:
+		static constexpr size_t SATURATION_FACTOR = 2;
+
+	private:
+		std::vector<std::unique_ptr<WorkerQueue>> queues_;
+		std::vector<std::thread> threads_;
+		std::atomic<size_t> queuedCount_;
+		std::atomic<bool> stop_;
+		std::mutex idleMutex_;
+		std::condition_variable idle_;
+	};
+
+	namespace details
+	{
+		/**
+		 * @brief Pool and queue of the calling thread if it is a worker.
+		 */
+		inline thread_local const WorkStealingPool* currentPool = nullptr;
+		inline thread_local size_t currentQueueIndex = 0;
+	}
+
+	//----------
+
+	inline WorkStealingPool::TaskGroup::TaskGroup() :
+		pending_(0),
+		error_(nullptr)
+	{
+	}
+
+	inline WorkStealingPool::WorkStealingPool() :
+		WorkStealingPool((std::max)(std::thread::hardware_concurrency(), 1u))
+	{
+	}
+
+	inline WorkStealingPool::WorkStealingPool(size_t threadCount) :
+		queuedCount_(0),
+		stop_(false)
+	{
+		for (size_t i = 0; i <= threadCount; ++i)
+		{
+			queues_.push_back(std::make_unique<WorkerQueue>());
+		}
+
+		for (size_t i = 0; i < threadCount; ++i)
+		{
+			threads_.emplace_back([this, i]() { this->runWorker(i); });
+		}
+	}
+
+	inline WorkStealingPool::~WorkStealingPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(idleMutex_);
+			stop_ = true;
+		}
+		idle_.notify_all();
+
+		for (std::thread& thread : threads_)
+		{
+			thread.join();
+		}
+	}
+
+	inline WorkStealingPool& WorkStealingPool::getShared()
+	{
+		static WorkStealingPool pool;
+		return pool;
+	}
+
+	inline size_t WorkStealingPool::getThreadCount() const
+	{
+		return threads_.size();
+	}
+
+	inline bool WorkStealingPool::isSaturated() const
+	{
+		return queuedCount_.load(std::memory_order_relaxed) >= SATURATION_FACTOR * threads_.size();
+	}
+
+	template<typename Function>
+	void WorkStealingPool::fork(TaskGroup& group, Function&& task)
+	{
+		group.pending_.fetch_add(1, std::memory_order_relaxed);
+		this->push({ std::function<void()>(std::forward<Function>(task)), &group });
+	}
+
+	inline void WorkStealingPool::wait(TaskGroup& group)
+	{
+		Task task;
+		while (group.pending_.load(std::memory_order_acquire) > 0)
+		{
+			if (this->tryTakeTask(task))
+			{
+				this->execute(task);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (group.error_ != nullptr)
+		{
+			std::exception_ptr error = group.error_;
+			group.error_ = nullptr;
+			std::rethrow_exception(error);
+		}
+	}
+
+	inline void WorkStealingPool::push(Task task)
+	{
+		// The count is raised first, so it never drops below zero when the task is taken at once.
+		queuedCount_.fetch_add(1, std::memory_order_relaxed);
+		WorkerQueue& queue = *queues_[this->currentQueue()];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex_);
+			queue.tasks_.push_back(std::move(task));
+		}
+
+		// Taking the lock orders the push before a worker that is just going to sleep checks the count.
+		{
+			std::lock_guard<std::mutex> lock(idleMutex_);
+		}
+		idle_.notify_one();
+	}
+
+	inline bool WorkStealingPool::tryTakeTask(Task& task)
+	{
+		if (queuedCount_.load(std::memory_order_acquire) == 0)
+		{
+			return false;
+		}
+
+		const size_t own = this->currentQueue();
+		{
+			WorkerQueue& queue = *queues_[own];
+			std::lock_guard<std::mutex> lock(queue.mutex_);
+			if (!queue.tasks_.empty())
+			{
+				task = std::move(queue.tasks_.back());
+				queue.tasks_.pop_back();
+				queuedCount_.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		for (size_t i = 1; i < queues_.size(); ++i)
+		{
+			WorkerQueue& queue = *queues_[(own + i) % queues_.size()];
+			std::lock_guard<std::mutex> lock(queue.mutex_);
+			if (!queue.tasks_.empty())
+			{
+				task = std::move(queue.tasks_.front());
+				queue.tasks_.pop_front();
+				queuedCount_.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	inline void WorkStealingPool::execute(Task& task)
+	{
+		TaskGroup& group = *task.group_;
+		try
+		{
+			task.run_();
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(group.errorMutex_);
+			if (group.error_ == nullptr)
+			{
+				group.error_ = std::current_exception();
+			}
+		}
+
+		task.run_ = nullptr;
+		group.pending_.fetch_sub(1, std::memory_order_release);
+	}
+
+	inline void WorkStealingPool::runWorker(size_t index)
+	{
+		details::currentPool = this;
+		details::currentQueueIndex = index;
+
+		Task task;
+		while (true)
+		{
+			if (this->tryTakeTask(task))
+			{
+				this->execute(task);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(idleMutex_);
+			idle_.wait(lock, [this]() { return stop_ || queuedCount_.load(std::memory_order_acquire) > 0; });
+			if (stop_)
+			{
+				return;
+			}
+		}
+	}
+
+	inline size_t WorkStealingPool::currentQueue() const
+	{
+		return details::currentPool == this ? details::currentQueueIndex : queues_.size() - 1;
+	}
+
+}
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Creates default-constructed object at @p address.
  */
 template<typename T>
 T* placement_new(T* address)
 {
-    return new (address) T();
+    return ::new (address) T();
 }
 
 /**
@@ -15,7 +17,16 @@ T* placement_new(T* address)
 template<typename T>
 T* placement_copy(T* address, const T& origin)
 {
-    return new (address) T(origin);
+    return ::new (address) T(origin);
+}
+
+/**
+ * @brief Creates move-constructed object from @p origin at @p address.
+ */
+template<typename T>
+T* placement_move(T* address, T&& origin)
+{
+    return ::new (address) T(std::move(origin));
 }
 
 #if (defined(_WIN32) || defined(_WIN64)) \
@@ -27,4 +38,9 @@ T* placement_copy(T* address, const T& origin)
 
 #define initHeapMonitor() _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF)
 
+#else
+
+// portable leak reports of memory managers are provided by libds/mm/allocation_profiler.h
+#define initHeapMonitor() ((void)0)
+
 #endif
\ No newline at end of file
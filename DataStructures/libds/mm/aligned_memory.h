@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <malloc.h>
+#endif
+
+namespace ds::mm {
+
+	/**
+	 * @brief Size of a cache line, blocks aligned to it do not share cache lines.
+	 */
+	const size_t CACHE_LINE_SIZE = 64;
+
+	/**
+	 * @brief Returns true if @p alignment is stricter than what malloc guarantees.
+	 */
+	constexpr bool isOverAligned(size_t alignment)
+	{
+		return alignment > alignof(std::max_align_t);
+	}
+
+	/**
+	 * @brief Returns true if @p alignment is a power of two.
+	 */
+	inline bool isValidAlignment(size_t alignment)
+	{
+		return alignment != 0 && (alignment & (alignment - 1)) == 0;
+	}
+
+	/**
+	 * @brief Returns @p size rounded up to a multiple of @p alignment.
+	 */
+	inline size_t alignSize(size_t size, size_t alignment)
+	{
+		return (size + alignment - 1) / alignment * alignment;
+	}
+
+	/**
+	 * @brief Allocates zeroed memory whose address is a multiple of @p alignment.
+	 * Alignment has to be a power of two. Returns nullptr on failure.
+	 */
+	inline void* alignedAllocate(size_t size, size_t alignment)
+	{
+		if (!isValidAlignment(alignment))
+		{
+			return nullptr;
+		}
+
+		if (!isOverAligned(alignment))
+		{
+			return std::calloc(size, 1);
+		}
+
+		void* memory = nullptr;
+#if defined(_WIN32) || defined(_WIN64)
+		memory = _aligned_malloc(size, alignment);
+#else
+		if (posix_memalign(&memory, alignment, size) != 0)
+		{
+			memory = nullptr;
+		}
+#endif
+		if (memory != nullptr)
+		{
+			std::memset(memory, 0, size);
+		}
+		return memory;
+	}
+
+	/**
+	 * @brief Changes size of memory allocated by alignedAllocate, keeping its content.
+	 * Returns nullptr on failure, the original memory is then left untouched.
+	 */
+	inline void* alignedReallocate(void* memory, [[maybe_unused]] size_t oldSize, size_t newSize, size_t alignment)
+	{
+		if (!isValidAlignment(alignment))
+		{
+			return nullptr;
+		}
+
+		if (!isOverAligned(alignment))
+		{
+			return std::realloc(memory, newSize);
+		}
+
+#if defined(_WIN32) || defined(_WIN64)
+		return _aligned_realloc(memory, newSize, alignment);
+#else
+		void* newMemory = nullptr;
+		if (posix_memalign(&newMemory, alignment, newSize) != 0)
+		{
+			return nullptr;
+		}
+
+		if (memory != nullptr)
+		{
+			std::memcpy(newMemory, memory, (std::min)(oldSize, newSize));
+			std::free(memory);
+		}
+		return newMemory;
+#endif
+	}
+
+	/**
+	 * @brief Frees memory allocated by alignedAllocate or alignedReallocate.
+	 */
+	inline void alignedFree(void* memory, [[maybe_unused]] size_t alignment)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		if (isOverAligned(alignment))
+		{
+			_aligned_free(memory);
+			return;
+		}
+#endif
+		std::free(memory);
+	}
+
+}
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <cstddef>
+
+#ifdef DS_MM_PROFILER
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+#endif
+
+/**
+ * The allocation profiler exists only if DS_MM_PROFILER is defined for the
+ * whole project, otherwise memory managers get an empty hook and this header
+ * includes nothing but <cstddef>. Code paths are named by
+ * DS_MM_PROFILE_SCOPE("name"); a manager is attributed to the scopes active
+ * when it was created, followed by the name of its block type.
+ */
+
+namespace ds::mm {
+
+#ifdef DS_MM_PROFILER
+
+	class AllocationProfiler;
+
+	/**
+	 * @brief Counters of all managers created in the same scopes for the same block type.
+	 */
+	class AllocationSite
+	{
+	public:
+		AllocationSite(AllocationProfiler* profiler, std::string name);
+
+		void recordAllocation(size_t blockCount, size_t blockSize);
+		void recordRelease(size_t blockCount, size_t blockSize);
+
+		const std::string& getName() const;
+		size_t getAllocationCount() const;
+		size_t getReleaseCount() const;
+		size_t getAllocatedBytes() const;
+		size_t getLiveBytes() const;
+		size_t getPeakBytes() const;
+
+	private:
+		AllocationProfiler* profiler_;
+		std::string name_;
+		std::atomic<size_t> allocationCount_;
+		std::atomic<size_t> releaseCount_;
+		std::atomic<size_t> allocatedBytes_;
+		std::atomic<size_t> liveBytes_;
+		std::atomic<size_t> peakBytes_;
+	};
+
+	//----------
+
+	/**
+	 * @brief Collects allocations of memory managers per block type and scope.
+	 */
+	class AllocationProfiler
+	{
+	public:
+		AllocationProfiler();
+		AllocationProfiler(const AllocationProfiler& other) = delete;
+		~AllocationProfiler();
+
+		/**
+		 * @brief Returns profiler used by memory managers. At shutdown it reports
+		 * leaks to std::cerr and writes folded stacks if an output path is set.
+		 */
+		static AllocationProfiler& getInstance();
+
+		/**
+		 * @brief Returns site of the scopes active in the calling thread and @p type.
+		 */
+		AllocationSite* getSite(const std::type_info& type);
+
+		size_t getLiveBytes() const;
+		size_t getPeakBytes() const;
+
+		/**
+		 * @brief Writes counters of all sites and the overall peak.
+		 */
+		void report(std::ostream& os);
+
+		/**
+		 * @brief Writes leaked bytes of every site which did not release all blocks.
+		 * @return true if there was a leak.
+		 */
+		bool reportLeaks(std::ostream& os);
+
+		/**
+		 * @brief Writes peak bytes of every site in the folded stack format of flame graphs.
+		 */
+		void writeFoldedStacks(std::ostream& os);
+
+		void setOutputPath(std::string path);
+
+		static void pushScope(const char* name);
+		static void popScope();
+
+	private:
+		friend class AllocationSite;
+
+		void recordLiveBytes(size_t bytes, bool allocated);
+		static std::string getTypeName(const std::type_info& type);
+		static std::vector<const char*>& getScopes();
+
+	private:
+		std::mutex mutex_;
+		std::map<std::string, std::unique_ptr<AllocationSite>> sites_;
+		std::atomic<size_t> liveBytes_;
+		std::atomic<size_t> peakBytes_;
+		std::string outputPath_;
+	};
+
+	//----------
+
+	/**
+	 * @brief Names a code path for the allocation profiler until the end of its lifetime.
+	 */
+	class ProfilerScope
+	{
+	public:
+		explicit ProfilerScope(const char* name) { AllocationProfiler::pushScope(name); }
+		ProfilerScope(const ProfilerScope& other) = delete;
+		~ProfilerScope() { AllocationProfiler::popScope(); }
+	};
+
+	//----------
+
+	/**
+	 * @brief Reports allocations of a memory manager to the allocation profiler.
+	 */
+	template<typename BlockType>
+	class AllocationProfilerHook
+	{
+	public:
+		static constexpr bool ENABLED = true;
+
+	protected:
+		AllocationProfilerHook() : site_(AllocationProfiler::getInstance().getSite(typeid(BlockType))) {}
+		AllocationProfilerHook(const AllocationProfilerHook<BlockType>& other) : AllocationProfilerHook() {}
+
+		void profileAllocation(size_t blockCount) { site_->recordAllocation(blockCount, sizeof(BlockType)); }
+		void profileRelease(size_t blockCount) { site_->recordRelease(blockCount, sizeof(BlockType)); }
+
+	private:
+		AllocationSite* site_;
+	};
+
+#define DS_MM_PROFILE_SCOPE_CONCAT_(name, line) name##line
+#define DS_MM_PROFILE_SCOPE_NAME_(line) DS_MM_PROFILE_SCOPE_CONCAT_(dsProfilerScope, line)
+#define DS_MM_PROFILE_SCOPE(name) ds::mm::ProfilerScope DS_MM_PROFILE_SCOPE_NAME_(__LINE__)(name)
+
+	//----------
+
+	inline AllocationSite::AllocationSite(AllocationProfiler* profiler, std::string name) :
+		profiler_(profiler),
+		name_(std::move(name)),
+		allocationCount_(0),
+		releaseCount_(0),
+		allocatedBytes_(0),
+		liveBytes_(0),
+		peakBytes_(0)
+	{
+	}
+
+	inline void AllocationSite::recordAllocation(size_t blockCount, size_t blockSize)
+	{
+		const size_t bytes = blockCount * blockSize;
+		allocationCount_ += blockCount;
+		allocatedBytes_ += bytes;
+
+		const size_t live = liveBytes_ += bytes;
+		size_t peak = peakBytes_.load();
+		while (live > peak && !peakBytes_.compare_exchange_weak(peak, live))
+		{
+		}
+
+		profiler_->recordLiveBytes(bytes, true);
+	}
+
+	inline void AllocationSite::recordRelease(size_t blockCount, size_t blockSize)
+	{
+		const size_t bytes = blockCount * blockSize;
+		releaseCount_ += blockCount;
+		liveBytes_ -= bytes;
+		profiler_->recordLiveBytes(bytes, false);
+	}
+
+	inline const std::string& AllocationSite::getName() const
+	{
+		return name_;
+	}
+
+	inline size_t AllocationSite::getAllocationCount() const
+	{
+		return allocationCount_;
+	}
+
+	inline size_t AllocationSite::getReleaseCount() const
+	{
+		return releaseCount_;
+	}
+
+	inline size_t AllocationSite::getAllocatedBytes() const
+	{
+		return allocatedBytes_;
+	}
+
+	inline size_t AllocationSite::getLiveBytes() const
+	{
+		return liveBytes_;
+	}
+
+	inline size_t AllocationSite::getPeakBytes() const
+	{
+		return peakBytes_;
+	}
+
+	//----------
+
+	inline AllocationProfiler::AllocationProfiler() :
+		liveBytes_(0),
+		peakBytes_(0)
+	{
+	}
+
+	inline AllocationProfiler::~AllocationProfiler()
+	{
+		if (this != &getInstance())
+		{
+			return;
+		}
+
+		this->reportLeaks(std::cerr);
+
+		if (!outputPath_.empty())
+		{
+			std::ofstream ost(outputPath_);
+			this->writeFoldedStacks(ost);
+		}
+	}
+
+	inline AllocationProfiler& AllocationProfiler::getInstance()
+	{
+		static AllocationProfiler profiler;
+		return profiler;
+	}
+
+	inline AllocationSite* AllocationProfiler::getSite(const std::type_info& type)
+	{
+		std::string name;
+		for (const char* scope : getScopes())
+		{
+			name += scope;
+			name += ';';
+		}
+		name += getTypeName(type);
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::unique_ptr<AllocationSite>& site = sites_[name];
+		if (site == nullptr)
+		{
+			site = std::make_unique<AllocationSite>(this, name);
+		}
+		return site.get();
+	}
+
+	inline size_t AllocationProfiler::getLiveBytes() const
+	{
+		return liveBytes_;
+	}
+
+	inline size_t AllocationProfiler::getPeakBytes() const
+	{
+		return peakBytes_;
+	}
+
+	inline void AllocationProfiler::report(std::ostream& os)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		os << "site;allocations;releases;allocated;peak;live" << std::endl;
+		for (const auto& [name, site] : sites_)
+		{
+			os << name << ';'
+			   << site->getAllocationCount() << ';'
+			   << site->getReleaseCount() << ';'
+			   << site->getAllocatedBytes() << "B;"
+			   << site->getPeakBytes() << "B;"
+			   << site->getLiveBytes() << "B" << std::endl;
+		}
+		os << "peak = " << this->getPeakBytes() << "B" << std::endl;
+	}
+
+	inline bool AllocationProfiler::reportLeaks(std::ostream& os)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		bool leaked = false;
+		for (const auto& [name, site] : sites_)
+		{
+			if (site->getLiveBytes() > 0)
+			{
+				os << "leak: " << site->getLiveBytes() << "B in " << name << std::endl;
+				leaked = true;
+			}
+		}
+		return leaked;
+	}
+
+	inline void AllocationProfiler::writeFoldedStacks(std::ostream& os)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (const auto& [name, site] : sites_)
+		{
+			if (site->getPeakBytes() > 0)
+			{
+				os << name << ' ' << site->getPeakBytes() << '\n';
+			}
+		}
+	}
+
+	inline void AllocationProfiler::setOutputPath(std::string path)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		outputPath_ = std::move(path);
+	}
+
+	inline void AllocationProfiler::pushScope(const char* name)
+	{
+		getScopes().push_back(name);
+	}
+
+	inline void AllocationProfiler::popScope()
+	{
+		getScopes().pop_back();
+	}
+
+	inline void AllocationProfiler::recordLiveBytes(size_t bytes, bool allocated)
+	{
+		if (!allocated)
+		{
+			liveBytes_ -= bytes;
+			return;
+		}
+
+		const size_t live = liveBytes_ += bytes;
+		size_t peak = peakBytes_.load();
+		while (live > peak && !peakBytes_.compare_exchange_weak(peak, live))
+		{
+		}
+	}
+
+	inline std::string AllocationProfiler::getTypeName(const std::type_info& type)
+	{
+#if defined(__GNUG__)
+		int status = 0;
+		char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+		if (status == 0 && demangled != nullptr)
+		{
+			std::string name(demangled);
+			std::free(demangled);
+			return name;
+		}
+#endif
+		return type.name();
+	}
+
+	inline std::vector<const char*>& AllocationProfiler::getScopes()
+	{
+		thread_local std::vector<const char*> scopes;
+		return scopes;
+	}
+
+#else
+
+	/**
+	 * @brief Empty hook used when the allocation profiler is switched off.
+	 */
+	template<typename BlockType>
+	class AllocationProfilerHook
+	{
+	public:
+		static constexpr bool ENABLED = false;
+
+	protected:
+		void profileAllocation(size_t) {}
+		void profileRelease(size_t) {}
+	};
+
+#define DS_MM_PROFILE_SCOPE(name)
+
+#endif
+
+}
@@ -2,11 +2,16 @@
 
 #include <libds/mm/memory_manager.h>
 #include <libds/mm/memory_omanip.h>
+#include <libds/mm/aligned_memory.h>
+#include <libds/mm/growth_policy.h>
+#include <libds/mm/virtual_memory_region.h>
 #include <libds/constants.h>
 #include <cstdlib>
 #include <cstring>
+#include <new>
 #include <ostream>
 #include <algorithm>
+#include <type_traits>
 #include <iostream>
 
 namespace ds::mm {
@@ -16,13 +21,28 @@ namespace ds::mm {
 	public:
 		CompactMemoryManager();
 		CompactMemoryManager(size_t size);
+		CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy);
+		CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy, size_t alignment);
+		CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy, VirtualMemoryRegion* region);
 		CompactMemoryManager(const CompactMemoryManager<BlockType>& other);
 		~CompactMemoryManager() override;
 
 		BlockType* allocateMemory() override;
 		BlockType* allocateMemoryAt(size_t index);
 		void releaseMemory(BlockType* pointer) override;
+		bool canAdoptFrom(const MemoryManager<BlockType>& other) const override;
 		void releaseMemoryAt(size_t index);
+
+		/**
+		 * @brief Allocates @p count blocks in front of the block at @p index and returns the first of them.
+		 * Blocks behind them are moved once and memory grows at most once.
+		 */
+		BlockType* allocateMemoryAt(size_t index, size_t count);
+
+		/**
+		 * @brief Releases @p count blocks from @p index, blocks behind them are moved once.
+		 */
+		void releaseMemoryAt(size_t index, size_t count);
 		void releaseMemory();
 
 		size_t getCapacity() const;
@@ -35,18 +55,61 @@ namespace ds::mm {
 		void* calculateAddress(const BlockType& data);
 		size_t calculateIndex(const BlockType& data);
 		BlockType& getBlockAt(size_t index);
+		const BlockType& getBlockAt(size_t index) const;
 		void swap(size_t index1, size_t index2);
 
 		void print(std::ostream& os);
 
+		size_t getAlignment() const;
+
+		/**
+		 * @brief Switches the gap buffer mode. Free memory is then kept as a gap at
+		 * the last edited index, so inserts and removals only move the blocks between
+		 * the previous and the current edit. Blocks are still accessed in O(1).
+		 */
+		void useGapBuffer(bool enabled);
+		bool usesGapBuffer() const;
+
+		/**
+		 * @brief Blocks are stored in at most SEGMENT_COUNT contiguous segments.
+		 * Only the first one is non-empty unless the gap of the gap buffer is open.
+		 */
+		BlockType* getSegmentBegin(size_t segment) const;
+		BlockType* getSegmentEnd(size_t segment) const;
+
+		/**
+		 * @brief Closes the gap and returns the first of all contiguous blocks.
+		 */
+		BlockType* getContiguousBlocks();
+
+		static const size_t SEGMENT_COUNT = 2;
+
 	private:
+		CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy, VirtualMemoryRegion* region, size_t alignment);
+
 		size_t getAllocatedBlocksSize() const;
 		size_t getAllocatedCapacitySize() const;
+		void destroyBlocks(BlockType* from);
+		void shrinkAfterRelease();
+		void moveBlocks(BlockType* destination, BlockType* source, size_t count);
+		void reallocate(size_t newCapacity);
+		void destroyRange(BlockType* from, BlockType* to);
+		void openGap(size_t index);
+		void moveGap(size_t index);
+		void closeGap();
+
+		static constexpr bool TRIVIALLY_COPYABLE = std::is_trivially_copyable_v<BlockType>;
 
 	private:
 		BlockType* base_;
 		BlockType* end_;
 		BlockType* limit_;
+		GrowthPolicy* growthPolicy_;
+		VirtualMemoryRegion* region_;
+		size_t alignment_;
+		bool gapBuffer_;
+		size_t gapIndex_;
+		size_t gapSize_;
 
 		static const size_t INIT_SIZE = 4;
 	};
@@ -59,52 +122,149 @@ namespace ds::mm {
 
 	template<typename BlockType>
 	CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size) :
-		base_(static_cast<BlockType*>(std::calloc(size, sizeof(BlockType)))),
-		end_(base_),
-		limit_(base_ + size)
+		CompactMemoryManager(size, new GeometricGrowthPolicy())
+	{
+	}
+
+	template<typename BlockType>
+	CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy) :
+		CompactMemoryManager(size, growthPolicy, nullptr, alignof(BlockType))
+	{
+	}
+
+	template<typename BlockType>
+	CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy, size_t alignment) :
+		CompactMemoryManager(size, growthPolicy, nullptr, alignment)
 	{
 	}
 
+	template<typename BlockType>
+	CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy, VirtualMemoryRegion* region) :
+		CompactMemoryManager(size, growthPolicy, region, alignof(BlockType))
+	{
+	}
+
+	template<typename BlockType>
+	CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size, GrowthPolicy* growthPolicy, VirtualMemoryRegion* region, size_t alignment) :
+		base_(nullptr),
+		end_(nullptr),
+		limit_(nullptr),
+		growthPolicy_(growthPolicy),
+		region_(region),
+		alignment_((std::max)(alignment, alignof(BlockType))),
+		gapBuffer_(false),
+		gapIndex_(0),
+		gapSize_(0)
+	{
+		// the destructor does not run if the constructor throws
+		try
+		{
+			if (region_ != nullptr)
+			{
+				region_->setCommittedSize(size * sizeof(BlockType));
+				base_ = static_cast<BlockType*>(region_->getBase());
+			}
+			else
+			{
+				base_ = static_cast<BlockType*>(alignedAllocate(size * sizeof(BlockType), alignment_));
+			}
+
+			if (base_ == nullptr && size > 0)
+			{
+				throw std::bad_alloc();
+			}
+		}
+		catch (...)
+		{
+			delete region_;
+			delete growthPolicy_;
+			throw;
+		}
+
+		end_ = base_;
+		limit_ = base_ + size;
+
+		this->recordReservedBytes(this->getAllocatedCapacitySize());
+	}
+
 	template<typename BlockType>
 	CompactMemoryManager<BlockType>::CompactMemoryManager(const CompactMemoryManager<BlockType>& other) :
-		CompactMemoryManager(other.getAllocatedBlockCount())
+		CompactMemoryManager(
+			other.getAllocatedBlockCount(),
+			other.growthPolicy_->clone(),
+			other.region_ != nullptr ? new VirtualMemoryRegion(other.region_->getReservedSize(), other.region_->usesHugePages()) : nullptr,
+			other.alignment_)
 	{
+		gapBuffer_ = other.gapBuffer_;
 		this->assign(other);
 	}
 
 	template<typename BlockType>
 	CompactMemoryManager<BlockType>::~CompactMemoryManager()
 	{
-		// preco tu nemoze byt this?
-		CompactMemoryManager<BlockType>::releaseMemory(base_);
-		std::free(base_);
+		this->destroyBlocks(base_);
+		if (region_ != nullptr)
+		{
+			delete region_;
+		}
+		else
+		{
+			alignedFree(base_, alignment_);
+		}
+		delete growthPolicy_;
 
 		base_ = nullptr;
 		end_ = nullptr;
 		limit_ = nullptr;
+		growthPolicy_ = nullptr;
+		region_ = nullptr;
 	}
 
 	template<typename BlockType>
 	BlockType* CompactMemoryManager<BlockType>::allocateMemory()
 	{
-		return this->allocateMemoryAt(end_ - base_);
+		return this->allocateMemoryAt(this->getAllocatedBlockCount());
 	}
 
 	template<typename BlockType>
 	BlockType* CompactMemoryManager<BlockType>::allocateMemoryAt(size_t index)
 	{
 		//doucit sa 
-		if (end_ == limit_)
+		if (gapSize_ == 0 && end_ == limit_)
 		{
-			this->changeCapacity(2 * this->getAllocatedBlockCount());
+			size_t newCapacity = growthPolicy_->grow(limit_ - base_, this->getAllocatedBlockCount() + 1, sizeof(BlockType));
+			if (region_ != nullptr)
+			{
+				newCapacity = (std::max)(this->getAllocatedBlockCount() + 1, (std::min)(newCapacity, region_->getReservedSize() / sizeof(BlockType)));
+			}
+			this->changeCapacity(newCapacity);
+		}
+		if (gapBuffer_)
+		{
+			if (gapSize_ == 0)
+			{
+				this->openGap(index);
+			}
+			else
+			{
+				this->moveGap(index);
+			}
+
+			++gapIndex_;
+			--gapSize_;
+			++MemoryManager<BlockType>::allocatedBlockCount_;
+			this->recordAllocation();
+
+			return placement_new(base_ + index);
 		}
 		if (end_ - base_ > static_cast<std::ptrdiff_t>(index))
 		{
-			std::memmove(base_ + index + 1, base_ + index, ((end_ - base_) - index) * sizeof(BlockType));
+			this->moveBlocks(base_ + index + 1, base_ + index, (end_ - base_) - index);
 		}
 
 		++MemoryManager<BlockType>::allocatedBlockCount_;
 		++end_;
+		this->recordAllocation();
 
 		return placement_new(base_ + index);
 	}
@@ -112,36 +272,131 @@ namespace ds::mm {
 	template<typename BlockType>
 	void CompactMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
 	{
-		BlockType* p = pointer;
-		while (p != end_)
+		if (gapSize_ > 0)
 		{
-			p->~BlockType();
-			++p;
+			const size_t index = this->calculateIndex(*pointer);
+			this->closeGap();
+			pointer = base_ + index;
 		}
-		end_ = pointer;
-		MemoryManager<BlockType>::allocatedBlockCount_ = end_ - base_;
+		this->destroyBlocks(pointer);
+		this->shrinkAfterRelease();
+	}
+
+	template<typename BlockType>
+	bool CompactMemoryManager<BlockType>::canAdoptFrom(const MemoryManager<BlockType>& /*other*/) const
+	{
+		return false;
 	}
 
 	template<typename BlockType>
 	void CompactMemoryManager<BlockType>::releaseMemoryAt(size_t index)
 	{
+		if (gapBuffer_)
+		{
+			this->moveGap(index);
+			(base_ + index + gapSize_)->~BlockType();
+
+			++gapSize_;
+			--this->allocatedBlockCount_;
+			this->recordRelease();
+			this->shrinkAfterRelease();
+			return;
+		}
+
 		this->getBlockAt(index).~BlockType();
-		std::memmove(base_ + index, base_ + index + 1, (end_ - base_ - index - 1) * sizeof(BlockType));
+		this->moveBlocks(base_ + index, base_ + index + 1, end_ - base_ - index - 1);
 
 		--end_;
 		--this->allocatedBlockCount_;
+		this->recordRelease();
+		this->shrinkAfterRelease();
+	}
+
+	template<typename BlockType>
+	BlockType* CompactMemoryManager<BlockType>::allocateMemoryAt(size_t index, size_t count)
+	{
+		if (gapBuffer_ && gapSize_ >= count)
+		{
+			this->moveGap(index);
+			for (size_t i = 0; i < count; ++i)
+			{
+				placement_new(base_ + index + i);
+			}
+
+			gapIndex_ += count;
+			gapSize_ -= count;
+			MemoryManager<BlockType>::allocatedBlockCount_ += count;
+			this->recordAllocation(count);
+
+			return base_ + index;
+		}
+
+		this->closeGap();
+
+		const size_t blockCount = this->getAllocatedBlockCount();
+		if (blockCount + count > static_cast<size_t>(limit_ - base_))
+		{
+			size_t newCapacity = growthPolicy_->grow(limit_ - base_, blockCount + count, sizeof(BlockType));
+			if (region_ != nullptr)
+			{
+				newCapacity = (std::max)(blockCount + count, (std::min)(newCapacity, region_->getReservedSize() / sizeof(BlockType)));
+			}
+			this->changeCapacity(newCapacity);
+		}
+
+		this->moveBlocks(base_ + index + count, base_ + index, blockCount - index);
+		for (size_t i = 0; i < count; ++i)
+		{
+			placement_new(base_ + index + i);
+		}
+
+		MemoryManager<BlockType>::allocatedBlockCount_ += count;
+		end_ += count;
+		this->recordAllocation(count);
+
+		return base_ + index;
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::releaseMemoryAt(size_t index, size_t count)
+	{
+		if (gapBuffer_)
+		{
+			this->moveGap(index);
+			this->destroyRange(base_ + index + gapSize_, base_ + index + gapSize_ + count);
+
+			gapSize_ += count;
+			this->allocatedBlockCount_ -= count;
+			this->recordRelease(count);
+			this->shrinkAfterRelease();
+			return;
+		}
+
+		this->destroyRange(base_ + index, base_ + index + count);
+		this->moveBlocks(base_ + index, base_ + index + count, end_ - base_ - index - count);
+
+		end_ -= count;
+		this->allocatedBlockCount_ -= count;
+		this->recordRelease(count);
+		this->shrinkAfterRelease();
 	}
 
 	template<typename BlockType>
 	void CompactMemoryManager<BlockType>::releaseMemory()
 	{
+		if (gapBuffer_)
+		{
+			this->releaseMemoryAt(this->getAllocatedBlockCount() - 1);
+			return;
+		}
+
 		this->releaseMemory(end_ - 1);
 	}
 
 	template<typename BlockType>
 	size_t CompactMemoryManager<BlockType>::getCapacity() const
 	{
-		return (end_ - base_) * sizeof(BlockType);
+		return limit_ - base_;
 	}
 
 	template<typename BlockType>
@@ -149,33 +404,39 @@ namespace ds::mm {
 	{
 		if (this != &other)
 		{
-			this->releaseMemory(base_);
-			MemoryManager<BlockType>::allocatedBlockCount_ = other.MemoryManager<BlockType>::allocatedBlockCount_;
+			this->destroyBlocks(base_);
+			this->reallocate(other.limit_ - other.base_);
 
-			void* newBase = std::realloc(base_, other.getAllocatedCapacitySize());
+			MemoryManager<BlockType>::allocatedBlockCount_ = other.MemoryManager<BlockType>::allocatedBlockCount_;
+			end_ = base_ + MemoryManager<BlockType>::allocatedBlockCount_;
+			this->recordAllocation(MemoryManager<BlockType>::allocatedBlockCount_);
 
-			if (newBase == nullptr)
+			if constexpr (TRIVIALLY_COPYABLE)
 			{
-				throw std::bad_alloc();
+				if (other.base_ != nullptr)
+				{
+					// blocks behind the gap of the other manager follow its front part
+					std::memcpy(base_, other.base_, other.gapIndex_ * sizeof(BlockType));
+					std::memcpy(base_ + other.gapIndex_, other.base_ + other.gapIndex_ + other.gapSize_,
+						(other.getAllocatedBlockCount() - other.gapIndex_) * sizeof(BlockType));
+				}
 			}
-
-			base_ = static_cast<BlockType*>(newBase);
-			end_ = base_ + MemoryManager<BlockType>::allocatedBlockCount_;
-			limit_ = base_ + (other.limit_ - other.base_);
-
-			for (size_t i = 0; i < other.getAllocatedBlockCount(); ++i)
+			else
 			{
-				placement_copy(base_ + i, *(other.base_ + i));
+				for (size_t i = 0; i < other.getAllocatedBlockCount(); ++i)
+				{
+					placement_copy(base_ + i, other.getBlockAt(i));
+				}
 			}
-
-			return *this;
 		}
+
+		return *this;
 	}
 
 	template<typename BlockType>
 	void CompactMemoryManager<BlockType>::shrinkMemory()
 	{
-		size_t newCapacity = end_ - base_;
+		size_t newCapacity = growthPolicy_->shrink(this->getAllocatedBlockCount(), sizeof(BlockType));
 
 		if (newCapacity < CompactMemoryManager<BlockType>::INIT_SIZE)
 		{
@@ -193,57 +454,82 @@ namespace ds::mm {
 			return;
 		}
 
-		if (newCapacity < this->getAllocatedBlockCount())
-		{
-			this->releaseMemory(base_ + newCapacity);
-		}
+		this->closeGap();
 
-		void* newBase_ = std::realloc(base_, newCapacity * sizeof(BlockType));
-
-		if (newBase_ == nullptr)
+		if (newCapacity < this->getAllocatedBlockCount())
 		{
-			throw std::bad_alloc();
+			this->destroyBlocks(base_ + newCapacity);
 		}
 
-		base_ = static_cast<BlockType*>(newBase_);
-		end_ = base_ + MemoryManager<BlockType>::allocatedBlockCount_;
-		limit_ = base_ + newCapacity;
+		this->reallocate(newCapacity);
 	}
 
 	template<typename BlockType>
 	void CompactMemoryManager<BlockType>::clear()
 	{
-		this->releaseMemory(base_);
+		this->destroyBlocks(base_);
 	}
 
 	template<typename BlockType>
 	bool CompactMemoryManager<BlockType>::equals(const CompactMemoryManager<BlockType>& other) const
 	{
-		return this == &other || this->getAllocatedBlockCount() == other.getAllocatedBlockCount() &&
-			std::memcmp(base_, other.base_, this->getAllocatedBlocksSize()) == 0;
+		if (this == &other)
+		{
+			return true;
+		}
+
+		if (this->getAllocatedBlockCount() != other.getAllocatedBlockCount())
+		{
+			return false;
+		}
+
+		if (gapSize_ == 0 && other.gapSize_ == 0)
+		{
+			return std::memcmp(base_, other.base_, this->getAllocatedBlocksSize()) == 0;
+		}
+
+		for (size_t i = 0; i < this->getAllocatedBlockCount(); ++i)
+		{
+			if (std::memcmp(&this->getBlockAt(i), &other.getBlockAt(i), sizeof(BlockType)) != 0)
+			{
+				return false;
+			}
+		}
+		return true;
 	}
 
 	template<typename BlockType>
 	void* CompactMemoryManager<BlockType>::calculateAddress(const BlockType& data)
 	{
-		BlockType* p = base_;
-		while (p != end_ && p != &data)
-		{
-			++p;
-		}
-		return p == end_ ? nullptr : p;
+		return this->calculateIndex(data) != INVALID_INDEX ? const_cast<BlockType*>(&data) : nullptr;
 	}
 
 	template<typename BlockType>
 	size_t CompactMemoryManager<BlockType>::calculateIndex(const BlockType& data)
 	{
-		return &data < end_&&& data >= base_ ? &data - base_ : INVALID_INDEX;
+		if (&data >= end_ || &data < base_)
+		{
+			return INVALID_INDEX;
+		}
+
+		const size_t offset = &data - base_;
+		if (offset < gapIndex_ || gapSize_ == 0)
+		{
+			return offset;
+		}
+		return offset >= gapIndex_ + gapSize_ ? offset - gapSize_ : INVALID_INDEX;
 	}
 
 	template<typename BlockType>
 	BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index)
 	{
-		return *(base_ + index);
+		return *(base_ + (index < gapIndex_ ? index : index + gapSize_));
+	}
+
+	template<typename BlockType>
+	const BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index) const
+	{
+		return *(base_ + (index < gapIndex_ ? index : index + gapSize_));
 	}
 
 	template<typename BlockType>
@@ -255,7 +541,7 @@ namespace ds::mm {
 	template<typename BlockType>
 	size_t CompactMemoryManager<BlockType>::getAllocatedBlocksSize() const
 	{
-		return (end_ - base_) * sizeof(BlockType);
+		return this->getAllocatedBlockCount() * sizeof(BlockType);
 	}
 
 	template<typename BlockType>
@@ -264,6 +550,227 @@ namespace ds::mm {
 		return (limit_ - base_) * sizeof(BlockType);
 	}
 
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::destroyBlocks(BlockType* from)
+	{
+		this->recordRelease(this->getAllocatedBlockCount() - (from - base_));
+
+		if (gapSize_ > 0)
+		{
+			// while the gap is open, all blocks are destroyed
+			this->destroyRange(base_, base_ + gapIndex_);
+			this->destroyRange(base_ + gapIndex_ + gapSize_, end_);
+			gapSize_ = 0;
+		}
+		else
+		{
+			this->destroyRange(from, end_);
+		}
+		gapIndex_ = 0;
+		end_ = from;
+		MemoryManager<BlockType>::allocatedBlockCount_ = end_ - base_;
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::destroyRange(BlockType* from, BlockType* to)
+	{
+		BlockType* p = from;
+		while (p != to)
+		{
+			p->~BlockType();
+			++p;
+		}
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::shrinkAfterRelease()
+	{
+		const size_t capacity = limit_ - base_;
+		size_t newCapacity = growthPolicy_->shrinkAfterRelease(capacity, this->getAllocatedBlockCount(), sizeof(BlockType));
+
+		if (newCapacity < CompactMemoryManager<BlockType>::INIT_SIZE)
+		{
+			newCapacity = CompactMemoryManager<BlockType>::INIT_SIZE;
+		}
+
+		if (newCapacity < capacity)
+		{
+			this->changeCapacity(newCapacity);
+		}
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::moveBlocks(BlockType* destination, BlockType* source, size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		if constexpr (TRIVIALLY_COPYABLE)
+		{
+			std::memmove(destination, source, count * sizeof(BlockType));
+		}
+		else if (destination < source)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				placement_move(destination + i, std::move(source[i]));
+				source[i].~BlockType();
+			}
+		}
+		else
+		{
+			for (size_t i = count; i > 0; --i)
+			{
+				placement_move(destination + i - 1, std::move(source[i - 1]));
+				source[i - 1].~BlockType();
+			}
+		}
+
+		this->recordMovedBytes(count * sizeof(BlockType));
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::reallocate(size_t newCapacity)
+	{
+		const size_t blockCount = end_ - base_;
+		BlockType* newBase = nullptr;
+
+		if (region_ != nullptr)
+		{
+			// pages are committed in place, blocks never move
+			region_->setCommittedSize(newCapacity * sizeof(BlockType));
+			limit_ = base_ + newCapacity;
+			this->recordCapacityChange(this->getAllocatedCapacitySize());
+			return;
+		}
+
+		if constexpr (TRIVIALLY_COPYABLE)
+		{
+			newBase = static_cast<BlockType*>(alignedReallocate(base_, this->getAllocatedCapacitySize(), newCapacity * sizeof(BlockType), alignment_));
+			if (newBase == nullptr && newCapacity > 0)
+			{
+				throw std::bad_alloc();
+			}
+		}
+		else
+		{
+			newBase = static_cast<BlockType*>(alignedAllocate(newCapacity * sizeof(BlockType), alignment_));
+			if (newBase == nullptr && newCapacity > 0)
+			{
+				throw std::bad_alloc();
+			}
+
+			for (size_t i = 0; i < blockCount; ++i)
+			{
+				placement_move(newBase + i, std::move(base_[i]));
+				base_[i].~BlockType();
+			}
+			alignedFree(base_, alignment_);
+		}
+
+		base_ = newBase;
+		end_ = base_ + blockCount;
+		limit_ = base_ + newCapacity;
+		this->recordCapacityChange(this->getAllocatedCapacitySize());
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::openGap(size_t index)
+	{
+		// the gap takes all free memory behind the blocks
+		const size_t freeCount = limit_ - end_;
+		this->moveBlocks(base_ + index + freeCount, base_ + index, this->getAllocatedBlockCount() - index);
+
+		gapIndex_ = index;
+		gapSize_ = freeCount;
+		end_ = limit_;
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::moveGap(size_t index)
+	{
+		if (gapSize_ == 0)
+		{
+			gapIndex_ = index;
+			return;
+		}
+
+		if (index < gapIndex_)
+		{
+			this->moveBlocks(base_ + index + gapSize_, base_ + index, gapIndex_ - index);
+		}
+		else if (index > gapIndex_)
+		{
+			this->moveBlocks(base_ + gapIndex_, base_ + gapIndex_ + gapSize_, index - gapIndex_);
+		}
+		gapIndex_ = index;
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::closeGap()
+	{
+		if (gapSize_ == 0)
+		{
+			return;
+		}
+
+		this->moveBlocks(base_ + gapIndex_, base_ + gapIndex_ + gapSize_, this->getAllocatedBlockCount() - gapIndex_);
+		end_ -= gapSize_;
+		gapIndex_ = 0;
+		gapSize_ = 0;
+	}
+
+	template<typename BlockType>
+	size_t CompactMemoryManager<BlockType>::getAlignment() const
+	{
+		return alignment_;
+	}
+
+	template<typename BlockType>
+	void CompactMemoryManager<BlockType>::useGapBuffer(bool enabled)
+	{
+		if (!enabled)
+		{
+			this->closeGap();
+		}
+		gapBuffer_ = enabled;
+	}
+
+	template<typename BlockType>
+	bool CompactMemoryManager<BlockType>::usesGapBuffer() const
+	{
+		return gapBuffer_;
+	}
+
+	template<typename BlockType>
+	BlockType* CompactMemoryManager<BlockType>::getSegmentBegin(size_t segment) const
+	{
+		if (segment == 0)
+		{
+			return base_;
+		}
+		return gapSize_ > 0 ? base_ + gapIndex_ + gapSize_ : end_;
+	}
+
+	template<typename BlockType>
+	BlockType* CompactMemoryManager<BlockType>::getSegmentEnd(size_t segment) const
+	{
+		if (segment == 0)
+		{
+			return gapSize_ > 0 ? base_ + gapIndex_ : end_;
+		}
+		return end_;
+	}
+
+	template<typename BlockType>
+	BlockType* CompactMemoryManager<BlockType>::getContiguousBlocks()
+	{
+		this->closeGap();
+		return base_;
+	}
+
 	template<typename BlockType>
 	void CompactMemoryManager<BlockType>::print(std::ostream& os)
 	{
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ds::mm {
+
+	/**
+	 * @brief Decides how a compact memory manager changes its capacity.
+	 *
+	 * Capacities are counted in blocks, blockSize is the size of a block in bytes.
+	 */
+	class GrowthPolicy
+	{
+	public:
+		GrowthPolicy(bool shrinkAutomatically);
+		virtual ~GrowthPolicy() = default;
+		virtual GrowthPolicy* clone() const = 0;
+
+		/**
+		 * @brief Returns new capacity of a full memory. The result is at least @p required.
+		 */
+		size_t grow(size_t capacity, size_t required, size_t blockSize) const;
+
+		/**
+		 * @brief Returns capacity used by shrinkMemory for @p used blocks.
+		 */
+		size_t shrink(size_t used, size_t blockSize) const;
+
+		/**
+		 * @brief Returns capacity after a removal, @p capacity if memory should be kept.
+		 * Memory is halved once at most a quarter of it is used.
+		 */
+		size_t shrinkAfterRelease(size_t capacity, size_t used, size_t blockSize) const;
+
+	protected:
+		virtual size_t expand(size_t capacity) const = 0;
+		virtual size_t round(size_t capacity, size_t blockSize) const;
+
+	private:
+		bool shrinkAutomatically_;
+	};
+
+	//----------
+
+	/**
+	 * @brief Multiplies the capacity by a constant factor.
+	 */
+	class GeometricGrowthPolicy : public GrowthPolicy
+	{
+	public:
+		GeometricGrowthPolicy();
+		GeometricGrowthPolicy(double factor, bool shrinkAutomatically = false);
+		GrowthPolicy* clone() const override;
+
+	protected:
+		size_t expand(size_t capacity) const override;
+
+	private:
+		double factor_;
+	};
+
+	//----------
+
+	/**
+	 * @brief Adds a constant number of blocks to the capacity.
+	 */
+	class FixedIncrementGrowthPolicy : public GrowthPolicy
+	{
+	public:
+		FixedIncrementGrowthPolicy(size_t increment, bool shrinkAutomatically = false);
+		GrowthPolicy* clone() const override;
+
+	protected:
+		size_t expand(size_t capacity) const override;
+
+	private:
+		size_t increment_;
+	};
+
+	//----------
+
+	/**
+	 * @brief Grows geometrically and rounds the memory up to a size class
+	 * of the allocator, so the slack of the bucket is usable.
+	 */
+	class SizeClassGrowthPolicy : public GeometricGrowthPolicy
+	{
+	public:
+		SizeClassGrowthPolicy();
+		SizeClassGrowthPolicy(double factor, bool shrinkAutomatically = false);
+		GrowthPolicy* clone() const override;
+
+		static size_t sizeClass(size_t bytes);
+
+	protected:
+		size_t round(size_t capacity, size_t blockSize) const override;
+	};
+
+	//----------
+
+	/**
+	 * @brief Grows geometrically and, once the memory spans a huge page,
+	 * rounds it up to whole huge pages.
+	 */
+	class HugePageGrowthPolicy : public GeometricGrowthPolicy
+	{
+	public:
+		HugePageGrowthPolicy();
+		HugePageGrowthPolicy(size_t pageSize, double factor = 2.0, bool shrinkAutomatically = false);
+		GrowthPolicy* clone() const override;
+
+		static const size_t DEFAULT_PAGE_SIZE = 2 * 1024 * 1024;
+
+	protected:
+		size_t round(size_t capacity, size_t blockSize) const override;
+
+	private:
+		size_t pageSize_;
+	};
+
+	//----------
+
+	inline GrowthPolicy::GrowthPolicy(bool shrinkAutomatically) :
+		shrinkAutomatically_(shrinkAutomatically)
+	{
+	}
+
+	inline size_t GrowthPolicy::grow(size_t capacity, size_t required, size_t blockSize) const
+	{
+		return (std::max)(required, this->round(this->expand(capacity), blockSize));
+	}
+
+	inline size_t GrowthPolicy::shrink(size_t used, size_t blockSize) const
+	{
+		return this->round(used, blockSize);
+	}
+
+	inline size_t GrowthPolicy::shrinkAfterRelease(size_t capacity, size_t used, size_t blockSize) const
+	{
+		if (!shrinkAutomatically_ || used > capacity / 4)
+		{
+			return capacity;
+		}
+
+		return (std::min)(capacity, (std::max)(used, this->round(capacity / 2, blockSize)));
+	}
+
+	inline size_t GrowthPolicy::round(size_t capacity, size_t /*blockSize*/) const
+	{
+		return capacity;
+	}
+
+	inline GeometricGrowthPolicy::GeometricGrowthPolicy() :
+		GeometricGrowthPolicy(2.0)
+	{
+	}
+
+	inline GeometricGrowthPolicy::GeometricGrowthPolicy(double factor, bool shrinkAutomatically) :
+		GrowthPolicy(shrinkAutomatically),
+		factor_(factor > 1.0 ? factor : 2.0)
+	{
+	}
+
+	inline GrowthPolicy* GeometricGrowthPolicy::clone() const
+	{
+		return new GeometricGrowthPolicy(*this);
+	}
+
+	inline size_t GeometricGrowthPolicy::expand(size_t capacity) const
+	{
+		return (std::max)(capacity + 1, static_cast<size_t>(capacity * factor_));
+	}
+
+	inline FixedIncrementGrowthPolicy::FixedIncrementGrowthPolicy(size_t increment, bool shrinkAutomatically) :
+		GrowthPolicy(shrinkAutomatically),
+		increment_(increment > 0 ? increment : 1)
+	{
+	}
+
+	inline GrowthPolicy* FixedIncrementGrowthPolicy::clone() const
+	{
+		return new FixedIncrementGrowthPolicy(*this);
+	}
+
+	inline size_t FixedIncrementGrowthPolicy::expand(size_t capacity) const
+	{
+		return capacity + increment_;
+	}
+
+	inline SizeClassGrowthPolicy::SizeClassGrowthPolicy() :
+		SizeClassGrowthPolicy(1.5)
+	{
+	}
+
+	inline SizeClassGrowthPolicy::SizeClassGrowthPolicy(double factor, bool shrinkAutomatically) :
+		GeometricGrowthPolicy(factor, shrinkAutomatically)
+	{
+	}
+
+	inline GrowthPolicy* SizeClassGrowthPolicy::clone() const
+	{
+		return new SizeClassGrowthPolicy(*this);
+	}
+
+	inline size_t SizeClassGrowthPolicy::sizeClass(size_t bytes)
+	{
+		// multiples of 16 up to 128B, then four classes per power of two
+		const size_t quantum = 16;
+		if (bytes <= 8 * quantum)
+		{
+			return (bytes + quantum - 1) / quantum * quantum;
+		}
+
+		size_t power = 8 * quantum;
+		while (power * 2 < bytes)
+		{
+			power *= 2;
+		}
+
+		const size_t step = power / 4;
+		return (bytes + step - 1) / step * step;
+	}
+
+	inline size_t SizeClassGrowthPolicy::round(size_t capacity, size_t blockSize) const
+	{
+		return (std::max)(capacity, sizeClass(capacity * blockSize) / blockSize);
+	}
+
+	inline HugePageGrowthPolicy::HugePageGrowthPolicy() :
+		HugePageGrowthPolicy(DEFAULT_PAGE_SIZE)
+	{
+	}
+
+	inline HugePageGrowthPolicy::HugePageGrowthPolicy(size_t pageSize, double factor, bool shrinkAutomatically) :
+		GeometricGrowthPolicy(factor, shrinkAutomatically),
+		pageSize_(pageSize > 0 ? pageSize : DEFAULT_PAGE_SIZE)
+	{
+	}
+
+	inline GrowthPolicy* HugePageGrowthPolicy::clone() const
+	{
+		return new HugePageGrowthPolicy(*this);
+	}
+
+	inline size_t HugePageGrowthPolicy::round(size_t capacity, size_t blockSize) const
+	{
+		const size_t bytes = capacity * blockSize;
+		if (bytes < pageSize_)
+		{
+			return capacity;
+		}
+
+		const size_t pages = (bytes + pageSize_ - 1) / pageSize_;
+		return (std::max)(capacity, pages * pageSize_ / blockSize);
+	}
+
+}
@@ -1,11 +1,21 @@
 #pragma once
 
 #include <libds/heap_monitor.h>
+#include <libds/mm/aligned_memory.h>
+#include <libds/mm/memory_statistics.h>
+#include <cstddef>
+#include <new>
 
 namespace ds::mm {
 
+	/**
+	 * @brief Allocates every block separately on the heap.
+	 * Over-aligned blocks are allocated by alignedAllocate, because new of the heap monitor
+	 * does not honour alignment stricter than the default one.
+	 */
 	template<typename BlockType>
-	class MemoryManager {
+	class MemoryManager :
+		public MemoryStatisticsRecorder<BlockType> {
 
 	public:
 		MemoryManager();
@@ -18,6 +28,20 @@ namespace ds::mm {
 
 		size_t getAllocatedBlockCount() const;
 
+		/**
+		 * @brief Returns true if blocks allocated by @p other can be released by this manager.
+		 * The base manager allocates every block separately on the heap, so it accepts
+		 * blocks of any manager that accepts its blocks too.
+		 */
+		virtual bool canAdoptFrom(const MemoryManager<BlockType>& other) const;
+
+		/**
+		 * @brief Takes over @p count blocks allocated by @p other, the blocks stay where they are.
+		 * Blocks are only exchanged if both managers can adopt blocks of each other.
+		 * @return true if the blocks were taken over.
+		 */
+		bool adoptBlocks(MemoryManager<BlockType>& other, size_t count);
+
 	protected:
 		size_t allocatedBlockCount_;
 	};
@@ -37,15 +61,55 @@ namespace ds::mm {
 	template<typename BlockType>
 	BlockType* MemoryManager<BlockType>::allocateMemory()
 	{
+		BlockType* block;
+		if constexpr (isOverAligned(alignof(BlockType)))
+		{
+			void* memory = alignedAllocate(sizeof(BlockType), alignof(BlockType));
+			if (memory == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+			try
+			{
+				block = placement_new(static_cast<BlockType*>(memory));
+			}
+			catch (...)
+			{
+				alignedFree(memory, alignof(BlockType));
+				throw;
+			}
+		}
+		else
+		{
+			block = new BlockType();
+		}
+
 		allocatedBlockCount_++;
-		return new BlockType();
+		this->recordAllocation();
+		this->recordReservedBytes(allocatedBlockCount_ * sizeof(BlockType));
+		return block;
 	}
 
 	template<typename BlockType>
 	void MemoryManager<BlockType>::releaseMemory(BlockType* pointer)
 	{
 		allocatedBlockCount_--;
-		delete pointer;
+		this->recordRelease();
+		this->recordReservedBytes(allocatedBlockCount_ * sizeof(BlockType));
+
+		if constexpr (isOverAligned(alignof(BlockType)))
+		{
+			if (pointer != nullptr)
+			{
+				pointer->~BlockType();
+				alignedFree(pointer, alignof(BlockType));
+			}
+		}
+		else
+		{
+			delete pointer;
+		}
 	}
 
 	template<typename BlockType>
@@ -60,4 +124,25 @@ namespace ds::mm {
 	{
 		return allocatedBlockCount_;
 	}
+
+	template<typename BlockType>
+	bool MemoryManager<BlockType>::canAdoptFrom(const MemoryManager<BlockType>& /*other*/) const
+	{
+		return true;
+	}
+
+	template<typename BlockType>
+	bool MemoryManager<BlockType>::adoptBlocks(MemoryManager<BlockType>& other, size_t count)
+	{
+		if (!this->canAdoptFrom(other) || !other.canAdoptFrom(*this))
+		{
+			return false;
+		}
+
+		allocatedBlockCount_ += count;
+		other.allocatedBlockCount_ -= count;
+		this->recordReservedBytes(allocatedBlockCount_ * sizeof(BlockType));
+		other.recordReservedBytes(other.allocatedBlockCount_ * sizeof(BlockType));
+		return true;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <libds/mm/allocation_profiler.h>
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+
+/**
+ * Statistics of memory managers are collected only if DS_MM_STATISTICS
+ * is defined for the whole project. Otherwise all recording is a no-op.
+ * Allocations and releases are passed to the allocation profiler as well.
+ */
+
+namespace ds::mm {
+
+	/**
+	 * @brief Snapshot of counters collected by a memory manager.
+	 */
+	struct MemoryStatistics
+	{
+		size_t allocationCount_ = 0;
+		size_t releaseCount_ = 0;
+		size_t liveBlockCount_ = 0;
+		size_t peakBlockCount_ = 0;
+		size_t reservedBytes_ = 0;
+		size_t usedBytes_ = 0;
+		size_t capacityChangeCount_ = 0;
+		size_t movedBytes_ = 0;
+
+		void print(std::ostream& os) const;
+	};
+
+#ifdef DS_MM_STATISTICS
+
+	/**
+	 * @brief Collects statistics of a memory manager.
+	 */
+	template<typename BlockType>
+	class MemoryStatisticsRecorder : public AllocationProfilerHook<BlockType>
+	{
+	public:
+		static constexpr bool ENABLED = true;
+
+		MemoryStatistics getStatistics() const
+		{
+			MemoryStatistics result = statistics_;
+			result.usedBytes_ = result.liveBlockCount_ * sizeof(BlockType);
+			return result;
+		}
+
+	protected:
+		void recordAllocation(size_t blockCount = 1)
+		{
+			this->profileAllocation(blockCount);
+			statistics_.allocationCount_ += blockCount;
+			statistics_.liveBlockCount_ += blockCount;
+			statistics_.peakBlockCount_ = (std::max)(statistics_.peakBlockCount_, statistics_.liveBlockCount_);
+		}
+
+		void recordRelease(size_t blockCount = 1)
+		{
+			this->profileRelease(blockCount);
+			statistics_.releaseCount_ += blockCount;
+			statistics_.liveBlockCount_ -= blockCount;
+		}
+
+		void recordReservedBytes(size_t bytes)
+		{
+			statistics_.reservedBytes_ = bytes;
+		}
+
+		void recordCapacityChange(size_t reservedBytes)
+		{
+			++statistics_.capacityChangeCount_;
+			statistics_.reservedBytes_ = reservedBytes;
+		}
+
+		void recordMovedBytes(size_t bytes)
+		{
+			statistics_.movedBytes_ += bytes;
+		}
+
+	private:
+		MemoryStatistics statistics_;
+	};
+
+#else
+
+	/**
+	 * @brief Empty recorder used when statistics are switched off.
+	 */
+	template<typename BlockType>
+	class MemoryStatisticsRecorder : public AllocationProfilerHook<BlockType>
+	{
+	public:
+		static constexpr bool ENABLED = false;
+
+		MemoryStatistics getStatistics() const { return MemoryStatistics(); }
+
+	protected:
+		void recordAllocation(size_t blockCount = 1) { this->profileAllocation(blockCount); }
+		void recordRelease(size_t blockCount = 1) { this->profileRelease(blockCount); }
+		void recordReservedBytes(size_t) {}
+		void recordCapacityChange(size_t) {}
+		void recordMovedBytes(size_t) {}
+	};
+
+#endif
+
+	inline void MemoryStatistics::print(std::ostream& os) const
+	{
+		os << "allocations = " << allocationCount_ << std::endl;
+		os << "releases = " << releaseCount_ << std::endl;
+		os << "live blocks = " << liveBlockCount_ << std::endl;
+		os << "peak blocks = " << peakBlockCount_ << std::endl;
+		os << "reserved = " << reservedBytes_ << "B" << std::endl;
+		os << "used = " << usedBytes_ << "B" << std::endl;
+		os << "capacity changes = " << capacityChangeCount_ << std::endl;
+		os << "moved = " << movedBytes_ << "B" << std::endl;
+	}
+
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <libds/heap_monitor.h>
+#include <libds/mm/memory_manager.h>
+#include <libds/mm/aligned_memory.h>
+#include <cstddef>
+
+namespace ds::mm {
+
+	/**
+	 * @brief Memory manager handing out blocks from chunks by bumping a pointer.
+	 *
+	 * Releasing a single block only destroys it, its memory is not reused.
+	 * All memory is given back at once by releaseAll, or automatically when
+	 * the last allocated block is released.
+	 */
+	template<typename BlockType>
+	class MonotonicArenaMemoryManager : public MemoryManager<BlockType> {
+	public:
+		MonotonicArenaMemoryManager();
+		MonotonicArenaMemoryManager(size_t chunkCapacity);
+		MonotonicArenaMemoryManager(size_t chunkCapacity, size_t alignment);
+		MonotonicArenaMemoryManager(const MonotonicArenaMemoryManager<BlockType>& other) = delete;
+		~MonotonicArenaMemoryManager() override;
+
+		BlockType* allocateMemory() override;
+		void releaseMemory(BlockType* pointer) override;
+		bool canAdoptFrom(const MemoryManager<BlockType>& other) const override;
+
+		/**
+		 * @brief Frees all chunks except the first one in O(chunks).
+		 * Blocks are not destroyed, so allocated blocks must be trivially
+		 * destructible or already destroyed.
+		 */
+		void releaseAll();
+
+		size_t getChunkCount() const;
+		size_t getChunkCapacity() const;
+		size_t getAlignment() const;
+
+		static const size_t DEFAULT_CHUNK_CAPACITY = 1024;
+
+	private:
+		struct alignas(BlockType) Slot
+		{
+			unsigned char block_[sizeof(BlockType)];
+		};
+
+		struct Chunk
+		{
+			Chunk* previous_;
+			unsigned char* memory_;
+		};
+
+		void addChunk();
+
+	private:
+		Chunk* lastChunk_;
+		size_t chunkCount_;
+		size_t chunkCapacity_;
+		size_t usedInLastChunk_;
+		size_t alignment_;
+		size_t slotSize_;
+	};
+
+	template<typename BlockType>
+	MonotonicArenaMemoryManager<BlockType>::MonotonicArenaMemoryManager() :
+		MonotonicArenaMemoryManager(DEFAULT_CHUNK_CAPACITY)
+	{
+	}
+
+	template<typename BlockType>
+	MonotonicArenaMemoryManager<BlockType>::MonotonicArenaMemoryManager(size_t chunkCapacity) :
+		MonotonicArenaMemoryManager(chunkCapacity, alignof(Slot))
+	{
+	}
+
+	template<typename BlockType>
+	MonotonicArenaMemoryManager<BlockType>::MonotonicArenaMemoryManager(size_t chunkCapacity, size_t alignment) :
+		lastChunk_(nullptr),
+		chunkCount_(0),
+		chunkCapacity_(chunkCapacity > 0 ? chunkCapacity : 1),
+		usedInLastChunk_(0),
+		alignment_((std::max)(alignment, alignof(Slot))),
+		slotSize_(alignSize(sizeof(Slot), alignment_))
+	{
+	}
+
+	template<typename BlockType>
+	MonotonicArenaMemoryManager<BlockType>::~MonotonicArenaMemoryManager()
+	{
+		this->releaseAll();
+
+		if (lastChunk_ != nullptr)
+		{
+			alignedFree(lastChunk_->memory_, alignment_);
+			delete lastChunk_;
+			lastChunk_ = nullptr;
+		}
+
+		chunkCount_ = 0;
+	}
+
+	template<typename BlockType>
+	BlockType* MonotonicArenaMemoryManager<BlockType>::allocateMemory()
+	{
+		if (lastChunk_ == nullptr || usedInLastChunk_ == chunkCapacity_)
+		{
+			this->addChunk();
+		}
+
+		Slot* slot = reinterpret_cast<Slot*>(lastChunk_->memory_ + usedInLastChunk_ * slotSize_);
+		++usedInLastChunk_;
+		++MemoryManager<BlockType>::allocatedBlockCount_;
+		this->recordAllocation();
+
+		return placement_new(reinterpret_cast<BlockType*>(slot));
+	}
+
+	template<typename BlockType>
+	void MonotonicArenaMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
+	{
+		pointer->~BlockType();
+		--MemoryManager<BlockType>::allocatedBlockCount_;
+		this->recordRelease();
+
+		if (MemoryManager<BlockType>::allocatedBlockCount_ == 0)
+		{
+			this->releaseAll();
+		}
+	}
+
+	template<typename BlockType>
+	bool MonotonicArenaMemoryManager<BlockType>::canAdoptFrom(const MemoryManager<BlockType>& /*other*/) const
+	{
+		return false;
+	}
+
+	template<typename BlockType>
+	void MonotonicArenaMemoryManager<BlockType>::releaseAll()
+	{
+		while (chunkCount_ > 1)
+		{
+			Chunk* previous = lastChunk_->previous_;
+			alignedFree(lastChunk_->memory_, alignment_);
+			delete lastChunk_;
+			lastChunk_ = previous;
+			--chunkCount_;
+		}
+
+		this->recordRelease(MemoryManager<BlockType>::allocatedBlockCount_);
+		this->recordReservedBytes(chunkCount_ * chunkCapacity_ * slotSize_);
+		usedInLastChunk_ = 0;
+		MemoryManager<BlockType>::allocatedBlockCount_ = 0;
+	}
+
+	template<typename BlockType>
+	size_t MonotonicArenaMemoryManager<BlockType>::getChunkCount() const
+	{
+		return chunkCount_;
+	}
+
+	template<typename BlockType>
+	size_t MonotonicArenaMemoryManager<BlockType>::getChunkCapacity() const
+	{
+		return chunkCapacity_;
+	}
+
+	template<typename BlockType>
+	size_t MonotonicArenaMemoryManager<BlockType>::getAlignment() const
+	{
+		return alignment_;
+	}
+
+	template<typename BlockType>
+	void MonotonicArenaMemoryManager<BlockType>::addChunk()
+	{
+		unsigned char* memory = static_cast<unsigned char*>(alignedAllocate(chunkCapacity_ * slotSize_, alignment_));
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		Chunk* chunk = new Chunk();
+		chunk->previous_ = lastChunk_;
+		chunk->memory_ = memory;
+
+		lastChunk_ = chunk;
+		usedInLastChunk_ = 0;
+		++chunkCount_;
+		this->recordReservedBytes(chunkCount_ * chunkCapacity_ * slotSize_);
+	}
+
+}
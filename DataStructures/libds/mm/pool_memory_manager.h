@@ -0,0 +1,190 @@
+#pragma once
+
+#include <libds/heap_monitor.h>
+#include <libds/mm/memory_manager.h>
+#include <libds/mm/aligned_memory.h>
+#include <cstddef>
+
+namespace ds::mm {
+
+	/**
+	 * @brief Memory manager carving blocks out of large slabs.
+	 *
+	 * Released blocks are kept in an intrusive free list and reused by later
+	 * allocations, so the global allocator is only hit once per slab.
+	 * Every block starts at a multiple of the alignment, with CACHE_LINE_SIZE
+	 * no two blocks share a cache line.
+	 */
+	template<typename BlockType>
+	class PoolMemoryManager : public MemoryManager<BlockType> {
+	public:
+		PoolMemoryManager();
+		PoolMemoryManager(size_t slabCapacity);
+		PoolMemoryManager(size_t slabCapacity, size_t alignment);
+		PoolMemoryManager(const PoolMemoryManager<BlockType>& other) = delete;
+		~PoolMemoryManager() override;
+
+		BlockType* allocateMemory() override;
+		void releaseMemory(BlockType* pointer) override;
+		bool canAdoptFrom(const MemoryManager<BlockType>& other) const override;
+
+		size_t getSlabCount() const;
+		size_t getSlabCapacity() const;
+		size_t getAlignment() const;
+
+		static const size_t DEFAULT_SLAB_CAPACITY = 256;
+
+	private:
+		union Slot
+		{
+			Slot* nextFree_;
+			alignas(BlockType) unsigned char block_[sizeof(BlockType)];
+		};
+
+		struct Slab
+		{
+			Slab* previous_;
+			unsigned char* memory_;
+		};
+
+		void addSlab();
+		Slot* getSlot(Slab* slab, size_t index) const;
+
+	private:
+		Slab* lastSlab_;
+		Slot* freeList_;
+		size_t slabCount_;
+		size_t slabCapacity_;
+		size_t usedInLastSlab_;
+		size_t alignment_;
+		size_t slotSize_;
+	};
+
+	template<typename BlockType>
+	PoolMemoryManager<BlockType>::PoolMemoryManager() :
+		PoolMemoryManager(DEFAULT_SLAB_CAPACITY)
+	{
+	}
+
+	template<typename BlockType>
+	PoolMemoryManager<BlockType>::PoolMemoryManager(size_t slabCapacity) :
+		PoolMemoryManager(slabCapacity, alignof(Slot))
+	{
+	}
+
+	template<typename BlockType>
+	PoolMemoryManager<BlockType>::PoolMemoryManager(size_t slabCapacity, size_t alignment) :
+		lastSlab_(nullptr),
+		freeList_(nullptr),
+		slabCount_(0),
+		slabCapacity_(slabCapacity > 0 ? slabCapacity : 1),
+		usedInLastSlab_(0),
+		alignment_((std::max)(alignment, alignof(Slot))),
+		slotSize_(alignSize(sizeof(Slot), alignment_))
+	{
+	}
+
+	template<typename BlockType>
+	PoolMemoryManager<BlockType>::~PoolMemoryManager()
+	{
+		while (lastSlab_ != nullptr)
+		{
+			Slab* previous = lastSlab_->previous_;
+			alignedFree(lastSlab_->memory_, alignment_);
+			delete lastSlab_;
+			lastSlab_ = previous;
+		}
+
+		freeList_ = nullptr;
+		slabCount_ = 0;
+		usedInLastSlab_ = 0;
+	}
+
+	template<typename BlockType>
+	BlockType* PoolMemoryManager<BlockType>::allocateMemory()
+	{
+		Slot* slot = nullptr;
+
+		if (freeList_ != nullptr)
+		{
+			slot = freeList_;
+			freeList_ = freeList_->nextFree_;
+		}
+		else
+		{
+			if (lastSlab_ == nullptr || usedInLastSlab_ == slabCapacity_)
+			{
+				this->addSlab();
+			}
+			slot = this->getSlot(lastSlab_, usedInLastSlab_);
+			++usedInLastSlab_;
+		}
+
+		++MemoryManager<BlockType>::allocatedBlockCount_;
+		this->recordAllocation();
+		return placement_new(reinterpret_cast<BlockType*>(slot));
+	}
+
+	template<typename BlockType>
+	void PoolMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
+	{
+		pointer->~BlockType();
+
+		Slot* slot = reinterpret_cast<Slot*>(pointer);
+		slot->nextFree_ = freeList_;
+		freeList_ = slot;
+
+		--MemoryManager<BlockType>::allocatedBlockCount_;
+		this->recordRelease();
+	}
+
+	template<typename BlockType>
+	bool PoolMemoryManager<BlockType>::canAdoptFrom(const MemoryManager<BlockType>& /*other*/) const
+	{
+		return false;
+	}
+
+	template<typename BlockType>
+	size_t PoolMemoryManager<BlockType>::getSlabCount() const
+	{
+		return slabCount_;
+	}
+
+	template<typename BlockType>
+	size_t PoolMemoryManager<BlockType>::getSlabCapacity() const
+	{
+		return slabCapacity_;
+	}
+
+	template<typename BlockType>
+	size_t PoolMemoryManager<BlockType>::getAlignment() const
+	{
+		return alignment_;
+	}
+
+	template<typename BlockType>
+	void PoolMemoryManager<BlockType>::addSlab()
+	{
+		unsigned char* memory = static_cast<unsigned char*>(alignedAllocate(slabCapacity_ * slotSize_, alignment_));
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		Slab* slab = new Slab();
+		slab->previous_ = lastSlab_;
+		slab->memory_ = memory;
+
+		lastSlab_ = slab;
+		usedInLastSlab_ = 0;
+		++slabCount_;
+		this->recordReservedBytes(slabCount_ * slabCapacity_ * slotSize_);
+	}
+
+	template<typename BlockType>
+	typename PoolMemoryManager<BlockType>::Slot* PoolMemoryManager<BlockType>::getSlot(Slab* slab, size_t index) const
+	{
+		return reinterpret_cast<Slot*>(slab->memory_ + index * slotSize_);
+	}
+
+}
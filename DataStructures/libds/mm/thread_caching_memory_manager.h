@@ -0,0 +1,247 @@
+#pragma once
+
+#include <libds/heap_monitor.h>
+#include <libds/mm/memory_manager.h>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace ds::mm {
+
+	/**
+	 * @brief Memory manager keeping released blocks in a free list of the
+	 * calling thread.
+	 *
+	 * Free lists exchange whole batches of blocks with a depot shared by all
+	 * managers of the same block type, so the depot lock and the global
+	 * allocator are hit once per batch. A block may be released by another
+	 * thread than the one that allocated it. A single manager is not
+	 * synchronized and has to be used by one thread at a time.
+	 */
+	template<typename BlockType>
+	class ThreadCachingMemoryManager : public MemoryManager<BlockType> {
+	public:
+		ThreadCachingMemoryManager() = default;
+		ThreadCachingMemoryManager(const ThreadCachingMemoryManager<BlockType>& other) = delete;
+
+		BlockType* allocateMemory() override;
+		void releaseMemory(BlockType* pointer) override;
+		bool canAdoptFrom(const MemoryManager<BlockType>& other) const override;
+
+		/**
+		 * @brief Returns number of free blocks cached by the calling thread.
+		 */
+		static size_t getCachedBlockCount();
+
+		static const size_t BATCH_SIZE = 64;
+
+	private:
+		union Slot
+		{
+			Slot* nextFree_;
+			alignas(BlockType) unsigned char block_[sizeof(BlockType)];
+		};
+
+		struct Batch
+		{
+			Slot* first_;
+			size_t size_;
+		};
+
+		class Depot
+		{
+		public:
+			~Depot();
+			Batch takeBatch();
+			void putBatch(Batch batch);
+
+		private:
+			std::mutex mutex_;
+			std::vector<Batch> batches_;
+			std::vector<Slot*> slabs_;
+		};
+
+		class ThreadCache
+		{
+		public:
+			ThreadCache();
+			~ThreadCache();
+			Slot* pop();
+			void push(Slot* slot);
+			size_t size() const;
+
+		private:
+			Batch popBatch();
+
+		private:
+			Slot* first_;
+			size_t size_;
+		};
+
+		static Depot& getDepot();
+		static ThreadCache& getThreadCache();
+	};
+
+	template<typename BlockType>
+	BlockType* ThreadCachingMemoryManager<BlockType>::allocateMemory()
+	{
+		Slot* slot = getThreadCache().pop();
+
+		++MemoryManager<BlockType>::allocatedBlockCount_;
+		this->recordAllocation();
+		return placement_new(reinterpret_cast<BlockType*>(slot));
+	}
+
+	template<typename BlockType>
+	void ThreadCachingMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
+	{
+		pointer->~BlockType();
+		getThreadCache().push(reinterpret_cast<Slot*>(pointer));
+
+		--MemoryManager<BlockType>::allocatedBlockCount_;
+		this->recordRelease();
+	}
+
+	template<typename BlockType>
+	bool ThreadCachingMemoryManager<BlockType>::canAdoptFrom(const MemoryManager<BlockType>& /*other*/) const
+	{
+		return false;
+	}
+
+	template<typename BlockType>
+	size_t ThreadCachingMemoryManager<BlockType>::getCachedBlockCount()
+	{
+		return getThreadCache().size();
+	}
+
+	template<typename BlockType>
+	typename ThreadCachingMemoryManager<BlockType>::Depot& ThreadCachingMemoryManager<BlockType>::getDepot()
+	{
+		static Depot depot;
+		return depot;
+	}
+
+	template<typename BlockType>
+	typename ThreadCachingMemoryManager<BlockType>::ThreadCache& ThreadCachingMemoryManager<BlockType>::getThreadCache()
+	{
+		// the depot has to outlive caches of all threads
+		getDepot();
+		thread_local ThreadCache cache;
+		return cache;
+	}
+
+	//----------
+
+	template<typename BlockType>
+	ThreadCachingMemoryManager<BlockType>::Depot::~Depot()
+	{
+		for (Slot* slab : slabs_)
+		{
+			delete[] slab;
+		}
+	}
+
+	template<typename BlockType>
+	typename ThreadCachingMemoryManager<BlockType>::Batch ThreadCachingMemoryManager<BlockType>::Depot::takeBatch()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!batches_.empty())
+			{
+				Batch batch = batches_.back();
+				batches_.pop_back();
+				return batch;
+			}
+		}
+
+		Slot* slab = new Slot[BATCH_SIZE];
+		for (size_t i = 0; i + 1 < BATCH_SIZE; ++i)
+		{
+			slab[i].nextFree_ = slab + i + 1;
+		}
+		slab[BATCH_SIZE - 1].nextFree_ = nullptr;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		slabs_.push_back(slab);
+		return { slab, BATCH_SIZE };
+	}
+
+	template<typename BlockType>
+	void ThreadCachingMemoryManager<BlockType>::Depot::putBatch(Batch batch)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		batches_.push_back(batch);
+	}
+
+	//----------
+
+	template<typename BlockType>
+	ThreadCachingMemoryManager<BlockType>::ThreadCache::ThreadCache() :
+		first_(nullptr),
+		size_(0)
+	{
+	}
+
+	template<typename BlockType>
+	ThreadCachingMemoryManager<BlockType>::ThreadCache::~ThreadCache()
+	{
+		while (size_ > 0)
+		{
+			getDepot().putBatch(this->popBatch());
+		}
+	}
+
+	template<typename BlockType>
+	typename ThreadCachingMemoryManager<BlockType>::Slot* ThreadCachingMemoryManager<BlockType>::ThreadCache::pop()
+	{
+		if (first_ == nullptr)
+		{
+			Batch batch = getDepot().takeBatch();
+			first_ = batch.first_;
+			size_ = batch.size_;
+		}
+
+		Slot* slot = first_;
+		first_ = first_->nextFree_;
+		--size_;
+		return slot;
+	}
+
+	template<typename BlockType>
+	void ThreadCachingMemoryManager<BlockType>::ThreadCache::push(Slot* slot)
+	{
+		slot->nextFree_ = first_;
+		first_ = slot;
+		++size_;
+
+		if (size_ >= 2 * BATCH_SIZE)
+		{
+			getDepot().putBatch(this->popBatch());
+		}
+	}
+
+	template<typename BlockType>
+	size_t ThreadCachingMemoryManager<BlockType>::ThreadCache::size() const
+	{
+		return size_;
+	}
+
+	template<typename BlockType>
+	typename ThreadCachingMemoryManager<BlockType>::Batch ThreadCachingMemoryManager<BlockType>::ThreadCache::popBatch()
+	{
+		Batch batch = { first_, 0 };
+		Slot* last = nullptr;
+
+		while (first_ != nullptr && batch.size_ < BATCH_SIZE)
+		{
+			last = first_;
+			first_ = first_->nextFree_;
+			++batch.size_;
+		}
+
+		last->nextFree_ = nullptr;
+		size_ -= batch.size_;
+		return batch;
+	}
+
+}
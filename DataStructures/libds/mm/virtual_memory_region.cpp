@@ -0,0 +1,117 @@
+#include <libds/mm/virtual_memory_region.h>
+#include <cstdint>
+#include <new>
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ds::mm {
+
+	VirtualMemoryRegion::VirtualMemoryRegion(size_t reservedSize, bool hugePages) :
+		mapping_(nullptr),
+		mappingSize_(0),
+		base_(nullptr),
+		reservedSize_(roundUp(reservedSize, hugePages ? HUGE_PAGE_SIZE : getPageSize())),
+		committedSize_(0),
+		hugePages_(hugePages)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		mappingSize_ = reservedSize_;
+		mapping_ = VirtualAlloc(nullptr, mappingSize_, MEM_RESERVE, PAGE_NOACCESS);
+		if (mapping_ == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+		base_ = static_cast<unsigned char*>(mapping_);
+#else
+		// huge pages need the range aligned to the huge page size
+		mappingSize_ = hugePages_ ? reservedSize_ + HUGE_PAGE_SIZE : reservedSize_;
+		mapping_ = mmap(nullptr, mappingSize_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (mapping_ == MAP_FAILED)
+		{
+			mapping_ = nullptr;
+			throw std::bad_alloc();
+		}
+
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mapping_);
+		base_ = reinterpret_cast<unsigned char*>(hugePages_ ? roundUp(address, HUGE_PAGE_SIZE) : address);
+#ifdef MADV_HUGEPAGE
+		if (hugePages_)
+		{
+			madvise(base_, reservedSize_, MADV_HUGEPAGE);
+		}
+#endif
+#endif
+	}
+
+	VirtualMemoryRegion::~VirtualMemoryRegion()
+	{
+		if (mapping_ != nullptr)
+		{
+#if defined(_WIN32) || defined(_WIN64)
+			VirtualFree(mapping_, 0, MEM_RELEASE);
+#else
+			munmap(mapping_, mappingSize_);
+#endif
+		}
+
+		mapping_ = nullptr;
+		base_ = nullptr;
+		committedSize_ = 0;
+	}
+
+	void VirtualMemoryRegion::setCommittedSize(size_t size)
+	{
+		if (size > reservedSize_)
+		{
+			throw std::bad_alloc();
+		}
+
+		const size_t newCommittedSize = roundUp(size, getPageSize());
+
+		if (newCommittedSize > committedSize_)
+		{
+#if defined(_WIN32) || defined(_WIN64)
+			if (VirtualAlloc(base_ + committedSize_, newCommittedSize - committedSize_, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+#else
+			if (mprotect(base_ + committedSize_, newCommittedSize - committedSize_, PROT_READ | PROT_WRITE) != 0)
+#endif
+			{
+				throw std::bad_alloc();
+			}
+		}
+		else if (newCommittedSize < committedSize_)
+		{
+#if defined(_WIN32) || defined(_WIN64)
+			VirtualFree(base_ + newCommittedSize, committedSize_ - newCommittedSize, MEM_DECOMMIT);
+#else
+			madvise(base_ + newCommittedSize, committedSize_ - newCommittedSize, MADV_DONTNEED);
+			mprotect(base_ + newCommittedSize, committedSize_ - newCommittedSize, PROT_NONE);
+#endif
+		}
+
+		committedSize_ = newCommittedSize;
+	}
+
+	size_t VirtualMemoryRegion::getPageSize()
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return info.dwPageSize;
+#else
+		return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+	}
+
+}
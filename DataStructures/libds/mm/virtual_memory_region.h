@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ds::mm {
+
+	/**
+	 * @brief Range of virtual memory reserved up front whose pages are
+	 * committed on demand, so the range can grow without moving.
+	 *
+	 * Huge pages are only a hint, used where transparent huge pages exist.
+	 * System calls live in virtual_memory_region.cpp, so that the platform
+	 * headers do not leak into every user of the memory managers.
+	 */
+	class VirtualMemoryRegion
+	{
+	public:
+		VirtualMemoryRegion(size_t reservedSize, bool hugePages = false);
+		VirtualMemoryRegion(const VirtualMemoryRegion& other) = delete;
+		~VirtualMemoryRegion();
+
+		void* getBase() const;
+		size_t getReservedSize() const;
+		size_t getCommittedSize() const;
+		bool usesHugePages() const;
+
+		/**
+		 * @brief Commits or decommits pages so that the first @p size bytes are usable.
+		 * @throws std::bad_alloc if @p size exceeds the reserved size.
+		 */
+		void setCommittedSize(size_t size);
+
+		static size_t getPageSize();
+
+		static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+	private:
+		static size_t roundUp(size_t size, size_t alignment);
+
+	private:
+		void* mapping_;
+		size_t mappingSize_;
+		unsigned char* base_;
+		size_t reservedSize_;
+		size_t committedSize_;
+		bool hugePages_;
+	};
+
+	inline void* VirtualMemoryRegion::getBase() const
+	{
+		return base_;
+	}
+
+	inline size_t VirtualMemoryRegion::getReservedSize() const
+	{
+		return reservedSize_;
+	}
+
+	inline size_t VirtualMemoryRegion::getCommittedSize() const
+	{
+		return committedSize_;
+	}
+
+	inline bool VirtualMemoryRegion::usesHugePages() const
+	{
+		return hugePages_;
+	}
+
+	inline size_t VirtualMemoryRegion::roundUp(size_t size, size_t alignment)
+	{
+		return (size + alignment - 1) / alignment * alignment;
+	}
+
+}
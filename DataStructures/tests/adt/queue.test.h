@@ -5,12 +5,57 @@
 
 namespace ds::tests
 {
+    /**
+     * @brief Tests pushes and pops at both ends of the deque.
+     */
+    class DequeTestEnds : public LeafTest
+    {
+    public:
+        DequeTestEnds() :
+            LeafTest("dequeEnds")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 1000;
+
+            adt::ImplicitDeque<int> deque(4);
+            for (int i = 0; i < n; ++i)
+            {
+                deque.pushBack(i);
+                deque.pushFront(-i - 1);
+            }
+            this->assert_equals(static_cast<size_t>(2 * n), deque.size());
+            this->assert_equals(-n, deque.peekFront());
+            this->assert_equals(n - 1, deque.peekBack());
+
+            bool same = true;
+            for (int i = n - 1; i >= 0; --i)
+            {
+                same = same && deque.popBack() == i;
+                same = same && deque.pop() == -i - 1;
+            }
+            this->assert_true(same, "Elements leave in order.");
+            this->assert_true(deque.isEmpty(), "Deque is empty.");
+
+            deque.push(1);
+            deque.push(2);
+            adt::ImplicitDeque<int> copy(deque);
+            this->assert_true(copy.equals(deque), "Copy is equal.");
+            this->assert_equals(1, copy.popFront());
+            this->assert_equals(2, copy.peek());
+        }
+    };
+
     class QueueTest : public CompositeTest
     {
     public:
         QueueTest() :
             CompositeTest("Queue")
         {
+            this->add_test(std::make_unique<DequeTestEnds>());
         }
     };
 }
\ No newline at end of file
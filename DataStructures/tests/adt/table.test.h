@@ -465,6 +465,167 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests lookups, lower bounds and range scans of the Eytzinger table
+     * for every size of the tree up to a few full levels
+     */
+    class EytzingerTableTestLookup : public details::TableTestBase<adt::EytzingerTable<int, int>>
+    {
+    public:
+        EytzingerTableTestLookup() :
+            details::TableTestBase<adt::EytzingerTable<int, int>>("lookup-lowerBound-range", 369)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr maxN = 70;
+            for (auto n = 0; n <= maxN; ++n)
+            {
+                // Keys are odd so even keys lie between them.
+                auto items = std::vector<adt::TabItem<int, int>>(n);
+                for (auto i = 0; i < n; ++i)
+                {
+                    items[i].key_ = 2 * i + 1;
+                    items[i].data_ = -i;
+                }
+                auto table = adt::EytzingerTable<int, int>(items.begin(), items.end());
+                this->assert_equals(static_cast<size_t>(n), table.size());
+
+                auto same = true;
+                for (auto key = -1; key <= 2 * n + 1; ++key)
+                {
+                    auto* data = static_cast<int*>(nullptr);
+                    auto const found = table.tryFind(key, data);
+                    same = same && found == (key % 2 != 0 && key > 0 && key < 2 * n);
+                    same = same && (!found || *data == -(key / 2));
+
+                    auto it = table.lowerBound(key);
+                    auto const expected = key < 1 ? 1 : (key % 2 != 0 ? key : key + 1);
+                    same = same && (expected > 2 * n ? it == table.end() : (*it).key_ == expected);
+                }
+                this->assert_true(same, "Lookups and lower bounds match for " + std::to_string(n) + " keys");
+
+                auto index = 0;
+                for (auto it = table.begin(); it != table.end(); ++it)
+                {
+                    same = same && (*it).key_ == 2 * index + 1;
+                    ++index;
+                }
+                this->assert_true(same && index == n, "Iterator visits keys in order");
+
+                auto visited = std::vector<int>();
+                table.processRange(n / 2, n + 3, [&visited](adt::TabItem<int, int>& item) { visited.push_back(item.key_); });
+                auto expectedKeys = std::vector<int>();
+                for (auto key = 1; key < 2 * n; key += 2)
+                {
+                    if (key >= n / 2 && key < n + 3)
+                    {
+                        expectedKeys.push_back(key);
+                    }
+                }
+                this->assert_true(visited == expectedKeys, "Range scan visits keys in [first, last)");
+            }
+        }
+    };
+
+    /**
+     * @brief Tests building the Eytzinger table from a sorted table, copying and immutability
+     */
+    class EytzingerTableTestBuild : public details::TableTestBase<adt::EytzingerTable<int, int>>
+    {
+    public:
+        EytzingerTableTestBuild() :
+            details::TableTestBase<adt::EytzingerTable<int, int>>("build-copy-assign", 147)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using base = details::TableTestBase<adt::EytzingerTable<int, int>>;
+
+            auto constexpr n = 100;
+            auto sorted = adt::SortedSequenceTable<int, int>();
+            auto keys = this->generateKeys(n);
+            for (auto const key : keys)
+            {
+                sorted.insert(key, key);
+            }
+
+            auto table1 = adt::EytzingerTable<int, int>(sorted);
+            this->assert_true(base::hasKeys(table1, keys), "Table built from a sorted table has its keys");
+            this->assert_equals(countItems(table1), static_cast<size_t>(n));
+
+            auto table2 = adt::EytzingerTable<int, int>(table1);
+            this->assert_true(base::hasKeys(table2, keys), "Copy constructed table is the same");
+            table1.clear();
+            this->assert_true(table1.isEmpty() && table1.begin() == table1.end(), "Cleared table is empty");
+            this->assert_false(table1.contains(keys.front()), "Cleared table has no keys");
+            this->assert_true(base::hasKeys(table2, keys), "Original does not share anything with the copy");
+
+            table1.assign(table2);
+            this->assert_true(base::hasKeys(table1, keys), "Copy assigned table is the same");
+            this->assert_equals(countItems(table1), static_cast<size_t>(n));
+
+            try
+            {
+                table1.insert(n, n);
+                this->fail("Insert should throw!");
+            }
+            catch (const adt::structure_error&)
+            {
+            }
+
+            try
+            {
+                (void)table1.remove(keys.front());
+                this->fail("Remove should throw!");
+            }
+            catch (const adt::structure_error&)
+            {
+            }
+
+            auto unsorted = std::vector<adt::TabItem<int, int>>(2);
+            unsorted[0].key_ = 1;
+            unsorted[1].key_ = 1;
+            try
+            {
+                auto table3 = adt::EytzingerTable<int, int>(unsorted.begin(), unsorted.end());
+                this->fail("Keys that are not strictly increasing should throw!");
+            }
+            catch (const adt::structure_error&)
+            {
+            }
+        }
+
+    private:
+        static size_t countItems(adt::EytzingerTable<int, int>& table)
+        {
+            auto count = static_cast<size_t>(0);
+            for (auto it = table.begin(); it != table.end(); ++it)
+            {
+                ++count;
+            }
+            return count;
+        }
+    };
+
+    /**
+     * @brief All Eytzinger table tests
+     */
+    class EytzingerTableTest : public CompositeTest
+    {
+    public:
+        EytzingerTableTest() :
+            CompositeTest("EytzingerTable")
+        {
+            this->add_test(std::make_unique<EytzingerTableTestLookup>());
+            this->add_test(std::make_unique<EytzingerTableTestBuild>());
+        }
+    };
+
     /**
      * @brief All sequence table implementations tests
      */
@@ -492,6 +653,7 @@ namespace ds::tests
             this->add_test(std::make_unique<GeneralTableTest<adt::HashTable<int, int>>>("HashTable"));
             this->add_test(std::make_unique<GeneralTableTest<adt::BinarySearchTree<int, int>>>("BinarySearchTree"));
             this->add_test(std::make_unique<GeneralTableTest<adt::Treap<int, int>>>("Treap"));
+            this->add_test(std::make_unique<EytzingerTableTest>());
         }
     };
 
@@ -510,6 +672,7 @@ namespace ds::tests
             this->add_test(std::make_unique<GeneralTableTest<adt::HashTable<int, int>>>("HashTable"));
             this->add_test(std::make_unique<GeneralTableTest<adt::BinarySearchTree<int, int>>>("BinarySearchTree"));
             this->add_test(std::make_unique<GeneralTableTest<adt::Treap<int, int>>>("Treap"));
+            this->add_test(std::make_unique<EytzingerTableTest>());
         }
     };
 }
\ No newline at end of file
@@ -3,6 +3,11 @@
 #include <tests/_details/test.hpp>
 #include <tests/amt/implicit_sequence.test.h>
 #include <tests/amt/explicit_sequence.test.h>
+#include <tests/amt/unrolled_linked_sequence.test.h>
+#include <tests/amt/skip_list_sequence.test.h>
+#include <tests/amt/chunked_implicit_sequence.test.h>
+#include <tests/amt/rope_sequence.test.h>
+#include <tests/amt/ring_implicit_sequence.test.h>
 #include <tests/amt/implicit_hierarchy.test.h>
 #include <tests/amt/explicit_hierarchy.test.h>
 #include <tests/amt/hierarchy.test.h>
@@ -18,6 +23,11 @@ namespace ds::tests
         {
             this->add_test(std::make_unique<ImplicitSequenceTest>());
             this->add_test(std::make_unique<ExplicitSequenceTest>());
+            this->add_test(std::make_unique<UnrolledLinkedSequenceTest>());
+            this->add_test(std::make_unique<SkipListSequenceTest>());
+            this->add_test(std::make_unique<ChunkedImplicitSequenceTest>());
+            this->add_test(std::make_unique<RopeSequenceTest>());
+            this->add_test(std::make_unique<RingImplicitSequenceTest>());
             this->add_test(std::make_unique<ImplicitHierarchyTest>());
             this->add_test(std::make_unique<ExplicitHierarchyTest>());
             this->add_test(std::make_unique<HierarchyTest>());
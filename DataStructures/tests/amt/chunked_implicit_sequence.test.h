@@ -0,0 +1,153 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <tests/amt/sequence.test.h>
+#include <libds/amt/chunked_implicit_sequence.h>
+#include <libds/mm/pool_memory_manager.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     *  @brief Tests that blocks inserted at the ends keep their addresses.
+     *  \tparam SequenceT Type of the chunked implicit sequence.
+     */
+    template<class SequenceT>
+    class ChunkedImplicitSequenceTestStability : public LeafTest
+    {
+    public:
+        explicit ChunkedImplicitSequenceTestStability(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 5000;
+
+            SequenceT seq;
+            std::vector<amt::MemoryBlock<int>*> blocks;
+            for (size_t i = 0; i < n; ++i)
+            {
+                amt::MemoryBlock<int>& last = seq.insertLast();
+                last.data_ = static_cast<int>(i);
+                blocks.push_back(&last);
+
+                amt::MemoryBlock<int>& first = seq.insertFirst();
+                first.data_ = -static_cast<int>(i) - 1;
+                blocks.push_back(&first);
+            }
+            this->assert_equals(2 * n, seq.size());
+
+            bool same = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                same = same && blocks[2 * i]->data_ == static_cast<int>(i);
+                same = same && blocks[2 * i + 1]->data_ == -static_cast<int>(i) - 1;
+                same = same && seq.access(n + i) == blocks[2 * i];
+                same = same && seq.access(n - i - 1) == blocks[2 * i + 1];
+            }
+            this->assert_true(same, "References stay valid while the sequence grows at both ends.");
+            this->assert_true(seq.getChunkCount() <= 2 * n / SequenceT::CHUNK_CAPACITY + 2, "Only partially filled chunks are at the ends.");
+
+            for (size_t i = 0; i < 10 * n; ++i)
+            {
+                seq.insertLast().data_ = static_cast<int>(i);
+                seq.removeFirst();
+            }
+            this->assert_equals(2 * n, seq.size());
+            this->assert_true(seq.getChunkCount() <= 2 * n / SequenceT::CHUNK_CAPACITY + 2, "Chunks are released behind a queue.");
+            this->assert_equals(static_cast<int>(10 * n - 1), seq.accessLast()->data_);
+
+            seq.clear();
+            this->assert_equals(static_cast<size_t>(0), seq.getChunkCount());
+            this->assert_null(seq.accessFirst());
+        }
+    };
+
+    /**
+     *  @brief Tests random inserts and removals against std::vector.
+     *  Chunks are allocated by a pool or one by one on the heap, which on MSVC
+     *  goes through new of the heap monitor.
+     *  \tparam SequenceT Type of the chunked implicit sequence.
+     */
+    template<class SequenceT>
+    class ChunkedImplicitSequenceTestRandom : public LeafTest
+    {
+    public:
+        explicit ChunkedImplicitSequenceTestRandom(const std::string& name, bool pooled) :
+            LeafTest(name),
+            pooled_(pooled)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 1000;
+
+            using ChunkType = typename SequenceT::ChunkType;
+            SequenceT seq(pooled_ ? new mm::PoolMemoryManager<ChunkType>(4) : new mm::MemoryManager<ChunkType>());
+            std::vector<int> expected;
+            std::mt19937 rng(5);
+            for (size_t step = 0; step < 4 * n; ++step)
+            {
+                if (rng() % 3 != 0 || expected.empty())
+                {
+                    const size_t index = rng() % (expected.size() + 1);
+                    const int data = static_cast<int>(rng());
+                    seq.insert(index).data_ = data;
+                    expected.insert(expected.begin() + index, data);
+                }
+                else
+                {
+                    const size_t index = rng() % expected.size();
+                    seq.remove(index);
+                    expected.erase(expected.begin() + index);
+                }
+            }
+
+            this->assert_equals(expected.size(), seq.size());
+
+            bool same = true;
+            size_t index = 0;
+            seq.forEach([&](amt::MemoryBlock<int>* block)
+                {
+                    same = same && block->data_ == expected[index] && seq.calculateIndex(*block) == index;
+                    ++index;
+                });
+            for (amt::MemoryBlock<int>* block = seq.accessLast(); block != nullptr; block = seq.accessPrevious(*block))
+            {
+                --index;
+                same = same && block->data_ == expected[index];
+            }
+            this->assert_true(same, "Blocks match after random edits.");
+        }
+
+    private:
+        bool pooled_;
+    };
+
+    /**
+     *  @brief All ChunkedImplicitSequence tests.
+     */
+    class ChunkedImplicitSequenceTest : public CompositeTest
+    {
+    public:
+        ChunkedImplicitSequenceTest() :
+            CompositeTest("ChunkedImplicitSequence")
+        {
+            this->add_test(std::make_unique<GenericSequenceTest<amt::ChunkedImplicitSequence<int, 1>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::ChunkedImplicitSequence<int, 24>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::ChunkedIS<int>>>());
+            this->add_test(std::make_unique<ChunkedImplicitSequenceTestStability<amt::ChunkedImplicitSequence<int, 40>>>("stability-40"));
+            this->add_test(std::make_unique<ChunkedImplicitSequenceTestStability<amt::ChunkedIS<int>>>("stability-4096"));
+            this->add_test(std::make_unique<ChunkedImplicitSequenceTestRandom<amt::ChunkedImplicitSequence<int, 36>>>("random-36", true));
+            this->add_test(std::make_unique<ChunkedImplicitSequenceTestRandom<amt::ChunkedIS<int>>>("random-4096", true));
+            this->add_test(std::make_unique<ChunkedImplicitSequenceTestRandom<amt::ChunkedIS<int>>>("random-4096-heap", false));
+        }
+    };
+}
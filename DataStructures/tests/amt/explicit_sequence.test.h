@@ -3,10 +3,159 @@
 #include <tests/_details/test.hpp>
 #include <tests/amt/sequence.test.h>
 #include <libds/amt/explicit_sequence.h>
+#include <libds/mm/pool_memory_manager.h>
+#include <libds/mm/monotonic_arena_memory_manager.h>
 #include <memory>
+#include <random>
+#include <thread>
+#include <vector>
 
 namespace ds::tests
 {
+    namespace details
+    {
+        /**
+         * @brief Sequence whose blocks are allocated by a memory manager of type @p ManagerT.
+         * \tparam SequenceT Type of the explicit sequence.
+         * \tparam ManagerT Template of the memory manager.
+         */
+        template<class SequenceT, template<typename> class ManagerT>
+        class ManagedSequence : public SequenceT
+        {
+        public:
+            ManagedSequence() :
+                SequenceT(new ManagerT<typename SequenceT::BlockType>(4))
+            {
+            }
+
+            ManagedSequence(const ManagedSequence& other) :
+                ManagedSequence()
+            {
+                this->assign(other);
+            }
+        };
+    }
+
+    /**
+     * @brief Tests positional operations starting from the remembered block against std::vector.
+     * \tparam SequenceT Type of the explicit sequence.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceTestFinger : public LeafTest
+    {
+    public:
+        ExplicitSequenceTestFinger() :
+            LeafTest("finger")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 300;
+
+            SequenceT seq;
+            std::vector<int> expected;
+            for (size_t i = 0; i < n; ++i)
+            {
+                seq.insert(i).data_ = static_cast<int>(i);
+                expected.push_back(static_cast<int>(i));
+            }
+
+            bool same = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                same = same && seq.access(i)->data_ == expected[i];
+            }
+            for (size_t i = n; i > 0; --i)
+            {
+                same = same && seq.access(i - 1)->data_ == expected[i - 1];
+            }
+            this->assert_true(same, "Sequential index loops find the right blocks.");
+
+            const SequenceT& constSeq = seq;
+            bool readersSame[2] = { true, true };
+            std::thread readers[2];
+            for (size_t r = 0; r < 2; ++r)
+            {
+                readers[r] = std::thread([&constSeq, &expected, &result = readersSame[r], r]()
+                    {
+                        for (size_t i = 0; i < expected.size(); ++i)
+                        {
+                            const size_t index = r == 0 ? i : expected.size() - 1 - i;
+                            result = result && constSeq.access(index)->data_ == expected[index];
+                        }
+                    });
+            }
+            for (std::thread& reader : readers)
+            {
+                reader.join();
+            }
+            this->assert_true(readersSame[0] && readersSame[1], "Concurrent const reads find the right blocks.");
+
+            std::mt19937 rng(11);
+            for (size_t step = 0; step < 4 * n; ++step)
+            {
+                const size_t index = expected.empty() ? 0 : rng() % expected.size();
+                const int data = static_cast<int>(rng());
+                switch (expected.empty() ? 0 : rng() % 6)
+                {
+                case 0:
+                    seq.insert(index).data_ = data;
+                    expected.insert(expected.begin() + index, data);
+                    break;
+                case 1:
+                    seq.remove(index);
+                    expected.erase(expected.begin() + index);
+                    break;
+                case 2:
+                    seq.insertAfter(*seq.access(index)).data_ = data;
+                    expected.insert(expected.begin() + index + 1, data);
+                    break;
+                case 3:
+                    seq.insertBefore(*seq.access(index)).data_ = data;
+                    expected.insert(expected.begin() + index, data);
+                    break;
+                case 4:
+                    if (index + 1 < expected.size())
+                    {
+                        seq.removeNext(*seq.access(index));
+                        expected.erase(expected.begin() + index + 1);
+                    }
+                    break;
+                default:
+                    if (index > 0)
+                    {
+                        seq.removePrevious(*seq.access(index));
+                        expected.erase(expected.begin() + index - 1);
+                    }
+                    break;
+                }
+
+                const size_t probe = expected.empty() ? 0 : rng() % expected.size();
+                for (size_t i = probe; i < expected.size() && i < probe + 3; ++i)
+                {
+                    amt::MemoryBlock<int>* block = seq.access(i);
+                    same = same && block->data_ == expected[i] && seq.calculateIndex(*seq.access(i)) == i;
+                }
+            }
+            this->assert_true(same, "Blocks match after random edits.");
+
+            seq.clear();
+            for (size_t i = 0; i < n; ++i)
+            {
+                seq.insertFirst().data_ = static_cast<int>(i);
+            }
+            seq.access(n / 2);
+            seq.insertFirst().data_ = -1;
+            seq.removeFirst();
+            seq.removeFirst();
+            this->assert_equals(static_cast<int>(n / 2 - 1), seq.access(n / 2 - 1)->data_);
+            seq.removeLast();
+            this->assert_equals(1, seq.access(seq.size() - 1)->data_);
+        }
+    };
+
     /**
      * @brief All tests for singly linked sequence.
      */
@@ -17,6 +166,7 @@ namespace ds::tests
             CompositeTest("SinglyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::SinglyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestFinger<amt::SinglyLinkedSequence<int>>>());
         }
     };
 
@@ -30,6 +180,35 @@ namespace ds::tests
             CompositeTest("DoublyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::DoublyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestFinger<amt::DoublyLinkedSequence<int>>>());
+        }
+    };
+
+    /**
+     * @brief All tests for linked sequences using the pool memory manager.
+     */
+    class PooledLinkedSequenceTest : public CompositeTest
+    {
+    public:
+        PooledLinkedSequenceTest() :
+            CompositeTest("PooledLinkedSequence")
+        {
+            this->add_test(std::make_unique<GenericSequenceTest<details::ManagedSequence<amt::SinglyLinkedSequence<int>, mm::PoolMemoryManager>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<details::ManagedSequence<amt::DoublyLinkedSequence<int>, mm::PoolMemoryManager>>>());
+        }
+    };
+
+    /**
+     * @brief All tests for linked sequences using the arena memory manager.
+     */
+    class ArenaLinkedSequenceTest : public CompositeTest
+    {
+    public:
+        ArenaLinkedSequenceTest() :
+            CompositeTest("ArenaLinkedSequence")
+        {
+            this->add_test(std::make_unique<GenericSequenceTest<details::ManagedSequence<amt::SinglyLinkedSequence<int>, mm::MonotonicArenaMemoryManager>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<details::ManagedSequence<amt::DoublyLinkedSequence<int>, mm::MonotonicArenaMemoryManager>>>());
         }
     };
 
@@ -44,6 +223,8 @@ namespace ds::tests
         {
             this->add_test(std::make_unique<SinglyLinkedSequenceTest>());
             this->add_test(std::make_unique<DoubleLinkedSequenceTest>());
+            this->add_test(std::make_unique<PooledLinkedSequenceTest>());
+            this->add_test(std::make_unique<ArenaLinkedSequenceTest>());
         }
     };
 }
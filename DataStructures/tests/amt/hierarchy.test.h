@@ -3,7 +3,13 @@
 #include <tests/_details/test.hpp>
 #include <libds/amt/implicit_hierarchy.h>
 #include <libds/amt/explicit_hierarchy.h>
+#include <libds/amt/work_stealing_pool.h>
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 namespace ds::tests
 {
@@ -196,6 +202,72 @@ namespace ds::tests
         }
     };
 
+    /**
+     *  @brief Tests iterators on a hierarchy deeper than the inline position stack.
+     */
+    class HierarchyTestDeepIterator : public LeafTest
+    {
+    public:
+        HierarchyTestDeepIterator() :
+            LeafTest("deep-iterator")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            // path 0 - 1 - ... - 99 with a leaf -i under every node i
+            constexpr int depth = 100;
+            amt::MultiWayExplicitHierarchy<int> hierarchy;
+            auto* node = &hierarchy.emplaceRoot();
+            node->data_ = 0;
+            for (int i = 1; i < depth; ++i)
+            {
+                hierarchy.emplaceSon(*node, 0).data_ = -i;
+                node = &hierarchy.emplaceSon(*node, 1);
+                node->data_ = i;
+            }
+
+            bool preOk = true;
+            auto preIt = hierarchy.beginPre();
+            for (int i = 0; i < depth; ++i)
+            {
+                preOk = preOk && *preIt == i;
+                ++preIt;
+                if (i + 1 < depth)
+                {
+                    preOk = preOk && *preIt == -(i + 1);
+                    ++preIt;
+                }
+            }
+            this->assert_true(preOk, "Pre-order visits nodes in order.");
+            this->assert_equals(hierarchy.endPre(), preIt);
+
+            auto postIt = hierarchy.beginPost();
+            for (int i = 1; i < depth; ++i)
+            {
+                ++postIt;
+            }
+            auto copyIt = postIt;
+            this->assert_equals(depth - 1, *postIt);
+            ++postIt;
+            this->assert_equals(depth - 2, *postIt);
+            this->assert_equals(depth - 1, *copyIt);
+            ++copyIt;
+            this->assert_true(copyIt == postIt, "Copied iterator continues independently.");
+
+            int sum = 0;
+            size_t count = 0;
+            for (auto it = hierarchy.beginPost(); it != hierarchy.endPost(); ++it)
+            {
+                sum += *it;
+                ++count;
+            }
+            this->assert_equals(hierarchy.size(), count);
+            this->assert_equals(0, sum);
+        }
+    };
+
     /**
      *  @brief Tests in-order traversal of a binary hierarchy.
      */
@@ -257,6 +329,177 @@ namespace ds::tests
                 ++hierarchyIt;
             }
             this->assert_equals(hierarchy.end(), hierarchyIt);
+
+            auto skipIt = hierarchy.begin();
+            ++skipIt;
+            ++skipIt;
+            ++skipIt;
+            this->assert_equals(10, *skipIt);
+        }
+    };
+
+    /**
+     *  @brief Tests operations of hierarchies called without virtual dispatch.
+     */
+    class HierarchyTestStaticDispatch : public LeafTest
+    {
+    public:
+        HierarchyTestStaticDispatch() :
+            LeafTest("static-dispatch")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            //        0
+            //   /         \
+            //   1         2
+            // / | \       |
+            // 3 4 5       6
+            auto hierarchy = details::makeHierarchy();
+            const amt::StaticHierarchy<amt::MultiWayExplicitHierarchy<int>> dispatch(&hierarchy);
+            const auto order = { 0, 1, 3, 4, 5, 2, 6 };
+            auto orderIt = begin(order);
+            dispatch.processPreOrder(dispatch.accessRoot(), [&orderIt, this](auto* node)
+                {
+                    this->assert_equals(*orderIt, node->data_);
+                    ++orderIt;
+                });
+
+            auto* one = dispatch.accessSon(*dispatch.accessRoot(), 0);
+            this->assert_equals(static_cast<size_t>(7), dispatch.nodeCount());
+            this->assert_equals(static_cast<size_t>(4), dispatch.nodeCount(*one));
+            this->assert_equals(static_cast<size_t>(3), dispatch.degree(*one));
+            this->assert_equals(static_cast<size_t>(2), dispatch.level(*dispatch.accessSon(*one, 2)));
+            this->assert_true(dispatch.isNthSon(*one, 0), "First son is first.");
+            this->assert_true(dispatch.isLeaf(*dispatch.accessSon(*one, 1)), "Grandson is a leaf.");
+            this->assert_false(dispatch.hasNthSon(*one, 3), "Node has three sons.");
+
+            dispatch.emplaceSon(*one, 3).data_ = 7;
+            this->assert_equals(static_cast<size_t>(8), hierarchy.nodeCount());
+            this->assert_equals(one, dispatch.accessParent(*dispatch.accessSon(*one, 3)));
+
+            //        10
+            //   /          \
+            //   5          15
+            // /   \      /
+            // 2   7     12
+            auto binary = details::makeBinaryHierarchy();
+            const amt::StaticHierarchy<amt::BinaryImplicitHierarchy<int>> binaryDispatch(&binary);
+            this->assert_equals(static_cast<size_t>(6), binaryDispatch.nodeCount(*binaryDispatch.accessRoot()));
+            this->assert_equals(12, binaryDispatch.accessSon(*binaryDispatch.accessSon(*binaryDispatch.accessRoot(), 1), 0)->data_);
+            this->assert_equals(static_cast<size_t>(3), binaryDispatch.nodeCount(*binaryDispatch.accessSon(*binaryDispatch.accessRoot(), 0)));
+        }
+    };
+
+    /**
+     *  @brief Tests parallel traversals and reduce against serial traversals.
+     */
+    class HierarchyTestParallel : public LeafTest
+    {
+    public:
+        HierarchyTestParallel() :
+            LeafTest("parallel")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            // random hierarchy whose node data are indices in pre-order
+            constexpr size_t n = 20000;
+            amt::MultiWayExplicitHierarchy<int> hierarchy;
+            std::mt19937 rng(13);
+            hierarchy.emplaceRoot();
+            for (size_t i = 1; i < n; ++i)
+            {
+                auto* node = hierarchy.accessRoot();
+                while (true)
+                {
+                    const size_t degree = hierarchy.degree(*node);
+                    const size_t sonOrder = rng() % (degree + 2);
+                    if (sonOrder >= degree)
+                    {
+                        hierarchy.emplaceSon(*node, degree);
+                        break;
+                    }
+                    node = hierarchy.accessSon(*node, sonOrder);
+                }
+            }
+            int index = 0;
+            hierarchy.processPreOrder(hierarchy.accessRoot(), [&index](const auto* node)
+                {
+                    const_cast<amt::MWEHBlock<int>*>(node)->data_ = index++;
+                });
+
+            amt::WorkStealingPool pool(4);
+            const auto map = [](const auto* node) { return std::vector<int>{ node->data_ }; };
+            const auto combine = [](std::vector<int> left, std::vector<int> right)
+                {
+                    left.insert(left.end(), right.begin(), right.end());
+                    return left;
+                };
+            bool inOrder = true;
+            for (size_t parallelDepth : { static_cast<size_t>(0), static_cast<size_t>(3), amt::MultiWayEH<int>::PARALLEL_DEPTH, n })
+            {
+                const std::vector<int> order = hierarchy.parallelReduce(hierarchy.accessRoot(), map, combine, pool, parallelDepth);
+                inOrder = inOrder && order.size() == n;
+                for (size_t i = 0; inOrder && i < n; ++i)
+                {
+                    inOrder = order[i] == static_cast<int>(i);
+                }
+            }
+            this->assert_true(inOrder, "Reduce combines results in pre-order.");
+
+            const auto one = [](const auto*) { return static_cast<size_t>(1); };
+            const auto sum = [](size_t left, size_t right) { return left + right; };
+            auto* son = hierarchy.accessSon(*hierarchy.accessRoot(), 0);
+            this->assert_equals(n, hierarchy.parallelReduce(hierarchy.accessRoot(), one, sum));
+            this->assert_equals(hierarchy.nodeCount(*son), hierarchy.parallelReduce(son, one, sum, pool));
+
+            std::vector<std::atomic<int>> visits(n);
+            hierarchy.processPreOrderParallel(hierarchy.accessRoot(), [&visits](const auto* node)
+                {
+                    visits[node->data_].fetch_add(1, std::memory_order_relaxed);
+                }, pool);
+            this->assert_true(std::all_of(visits.begin(), visits.end(), [](const std::atomic<int>& count) { return count.load() == 1; }), "Pre-order visits every node once.");
+
+            // every node is replaced by the size of its subtree, sons have to be processed first
+            std::vector<int> expected(n);
+            hierarchy.processPostOrder(hierarchy.accessRoot(), [&expected, &hierarchy](auto* node)
+                {
+                    expected[node->data_] = static_cast<int>(hierarchy.nodeCount(*node));
+                });
+            std::vector<int> sizes(n);
+            hierarchy.processPostOrderParallel(hierarchy.accessRoot(), [&sizes, &hierarchy](auto* node)
+                {
+                    int size = 1;
+                    for (size_t i = 0; i < hierarchy.degree(*node); ++i)
+                    {
+                        size += sizes[hierarchy.accessSon(*node, i)->data_];
+                    }
+                    sizes[node->data_] = size;
+                }, pool);
+            this->assert_true(sizes == expected, "Post-order processes sons before their parent.");
+
+            bool thrown = false;
+            try
+            {
+                hierarchy.processPreOrderParallel(hierarchy.accessRoot(), [](const auto* node)
+                    {
+                        if (node->data_ == static_cast<int>(n) / 2)
+                        {
+                            throw std::runtime_error("Node failed!");
+                        }
+                    }, pool);
+            }
+            catch (const std::runtime_error&)
+            {
+                thrown = true;
+            }
+            this->assert_true(thrown, "Exception of an operation is rethrown.");
+            this->assert_equals(n, hierarchy.parallelReduce(hierarchy.accessRoot(), one, sum, pool));
         }
     };
 
@@ -274,8 +517,11 @@ namespace ds::tests
             this->add_test(std::make_unique<HierarchyTestProcessLevelOrder>());
             this->add_test(std::make_unique<HierarchyTestPreOrderIterator>());
             this->add_test(std::make_unique<HierarchyTestPostOrderIterator>());
+            this->add_test(std::make_unique<HierarchyTestDeepIterator>());
             this->add_test(std::make_unique<BinaryHierarchyTestProcessInOrder>());
             this->add_test(std::make_unique<BinaryHierarchyTestInOrderIterator>());
+            this->add_test(std::make_unique<HierarchyTestStaticDispatch>());
+            this->add_test(std::make_unique<HierarchyTestParallel>());
         }
     };
 }
@@ -2,7 +2,10 @@
 
 #include <libds/amt/implicit_hierarchy.h>
 #include <tests/_details/test.hpp>
+#include <iterator>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace ds::tests
 {
@@ -174,6 +177,160 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests level, degree and their batch versions against a level by level walk.
+     * \tparam K Number of sons of inner nodes.
+     */
+    template<size_t K>
+    class ImplicitHierarchyTestLevelsDegsRange : public LeafTest
+    {
+    public:
+        ImplicitHierarchyTestLevelsDegsRange() :
+            LeafTest("level-degree-range-" + std::to_string(K))
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 500;
+            amt::ImplicitHierarchy<int, K> hierarchy;
+            bool same = true;
+            for (size_t size = 1; size <= n; ++size)
+            {
+                hierarchy.insertLastLeaf();
+                std::vector<size_t> levels;
+                std::vector<size_t> degrees;
+                hierarchy.levels(0, size, std::back_inserter(levels));
+                hierarchy.degrees(0, size, std::back_inserter(degrees));
+
+                size_t level = 0;
+                size_t levelEnd = 1;
+                size_t levelWidth = 1;
+                for (size_t index = 0; index < size; ++index)
+                {
+                    if (index == levelEnd)
+                    {
+                        ++level;
+                        levelWidth *= K;
+                        levelEnd += levelWidth;
+                    }
+                    const size_t firstSon = K * index + 1;
+                    const size_t degree = firstSon >= size ? 0 : (size - firstSon < K ? size - firstSon : K);
+                    same = same && hierarchy.level(index) == level && levels[index] == level;
+                    same = same && hierarchy.degree(index) == degree && degrees[index] == degree;
+                }
+
+                if (size > 2)
+                {
+                    std::vector<size_t> middle;
+                    hierarchy.levels(1, size - 2, std::back_inserter(middle));
+                    hierarchy.degrees(1, size - 2, std::back_inserter(middle));
+                    for (size_t i = 0; i < size - 2; ++i)
+                    {
+                        same = same && middle[i] == levels[i + 1] && middle[size - 2 + i] == degrees[i + 1];
+                    }
+                }
+            }
+            this->assert_true(same, "Levels and degrees match.");
+
+            std::vector<size_t> outside;
+            this->assert_throws([&hierarchy, &outside]()
+                {
+                    hierarchy.levels(n, 1, std::back_inserter(outside));
+                });
+        }
+    };
+
+    /**
+     * @brief Tests that a binary hierarchy with another layout behaves as the level order one.
+     * \tparam Layout Layout of the tested hierarchy.
+     */
+    template<class Layout>
+    class ImplicitHierarchyTestLayout : public LeafTest
+    {
+    public:
+        explicit ImplicitHierarchyTestLayout(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 700;
+            amt::BinaryImplicitHierarchy<int, Layout> hierarchy;
+            amt::BinaryImplicitHierarchy<int> expected;
+            bool same = true;
+            for (int i = 0; i < n; ++i)
+            {
+                hierarchy.insertLastLeaf().data_ = i;
+                expected.insertLastLeaf().data_ = i;
+                same = same && this->sameShape(hierarchy, expected);
+            }
+            this->assert_true(same, "Hierarchies are the same after inserts.");
+            this->assert_true(this->sameOrders(hierarchy, expected), "Traversals visit the same nodes.");
+
+            amt::BinaryImplicitHierarchy<int, Layout> copy(hierarchy);
+            this->assert_true(copy.equals(hierarchy), "Copy constructed hierarchy is the same.");
+
+            for (int i = 0; i < n - 10; ++i)
+            {
+                hierarchy.removeLastLeaf();
+                expected.removeLastLeaf();
+                same = same && this->sameShape(hierarchy, expected);
+            }
+            this->assert_true(same, "Hierarchies are the same after removals.");
+            this->assert_true(this->sameOrders(hierarchy, expected), "Traversals visit the same nodes after removals.");
+            this->assert_false(copy.equals(hierarchy), "Modified copy is different.");
+
+            copy.assign(hierarchy);
+            this->assert_true(copy.equals(hierarchy), "Assigned hierarchy is the same.");
+            copy.clear();
+            this->assert_equals(static_cast<size_t>(0), copy.size());
+            this->assert_null(copy.accessRoot());
+            copy.insertLastLeaf().data_ = 1;
+            this->assert_equals(1, copy.accessRoot()->data_);
+        }
+
+    private:
+        bool sameShape(amt::BinaryImplicitHierarchy<int, Layout>& hierarchy, amt::BinaryImplicitHierarchy<int>& expected)
+        {
+            if (hierarchy.size() != expected.size() || hierarchy.accessLastLeaf()->data_ != expected.accessLastLeaf()->data_)
+            {
+                return false;
+            }
+
+            auto* last = hierarchy.accessLastLeaf();
+            auto* parent = hierarchy.accessParent(*last);
+            if (parent == nullptr)
+            {
+                return expected.size() == 1;
+            }
+            return parent->data_ == expected.accessParent(*expected.accessLastLeaf())->data_
+                && hierarchy.accessSon(*parent, hierarchy.isLeftSon(*last) ? 0 : 1) == last
+                && hierarchy.degree(*parent) == expected.degree(*expected.accessParent(*expected.accessLastLeaf()))
+                && hierarchy.level(*last) == expected.level(*expected.accessLastLeaf());
+        }
+
+        bool sameOrders(amt::BinaryImplicitHierarchy<int, Layout>& hierarchy, amt::BinaryImplicitHierarchy<int>& expected)
+        {
+            std::vector<int> actualOrder;
+            std::vector<int> expectedOrder;
+            for (auto it = hierarchy.begin(); it != hierarchy.end(); ++it)
+            {
+                actualOrder.push_back(*it);
+            }
+            for (auto it = expected.begin(); it != expected.end(); ++it)
+            {
+                expectedOrder.push_back(*it);
+            }
+            hierarchy.processPostOrder(hierarchy.accessRoot(), [&actualOrder](const auto* block) { actualOrder.push_back(block->data_); });
+            expected.processPostOrder(expected.accessRoot(), [&expectedOrder](const auto* block) { expectedOrder.push_back(block->data_); });
+            return actualOrder == expectedOrder;
+        }
+    };
+
     /**
      *  @brief Tests removal of the last leaf.
      */
@@ -257,8 +414,15 @@ namespace ds::tests
             this->add_test(std::make_unique<ImplicitHierarchyTestInsert>());
             this->add_test(std::make_unique<ImplicitHierarchyTestAccess>());
             this->add_test(std::make_unique<ImplicitHierarchyTestLevelsCountsDegs>());
+            this->add_test(std::make_unique<ImplicitHierarchyTestLevelsDegsRange<2>>());
+            this->add_test(std::make_unique<ImplicitHierarchyTestLevelsDegsRange<3>>());
+            this->add_test(std::make_unique<ImplicitHierarchyTestLevelsDegsRange<4>>());
+            this->add_test(std::make_unique<ImplicitHierarchyTestLevelsDegsRange<7>>());
             this->add_test(std::make_unique<ImplicitHierarchyTestRemove>());
             this->add_test(std::make_unique<ImplicitHierarchyTestCopyAssign>());
+            this->add_test(std::make_unique<ImplicitHierarchyTestLayout<amt::VanEmdeBoasLayout>>("layout-van-emde-boas"));
+            this->add_test(std::make_unique<ImplicitHierarchyTestLayout<amt::BlockedLayout<1>>>("layout-blocked-1"));
+            this->add_test(std::make_unique<ImplicitHierarchyTestLayout<amt::BlockedLayout<3>>>("layout-blocked-3"));
         }
     };
 }
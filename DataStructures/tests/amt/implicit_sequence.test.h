@@ -67,6 +67,48 @@ namespace ds::tests
         }
     };
 
+    /**
+     *  @brief Tests contiguous view of blocks.
+     */
+    class ImplicitSequenceTestBlocks : public LeafTest
+    {
+    public:
+        ImplicitSequenceTestBlocks() :
+            LeafTest("getBlocks")
+        {
+        }
+
+        void test() override
+        {
+            constexpr int n = 10;
+
+            amt::GapImplicitSequence<int> seq;
+            for (int i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+            seq.remove(2);
+            seq.insert(2).data_ = 2;
+
+            amt::MemoryBlock<int>* found = seq.findBlockWithProperty([](const amt::MemoryBlock<int>* block)
+                {
+                    return block->data_ == 7;
+                });
+            this->assert_not_null(found);
+            this->assert_equals(static_cast<size_t>(7), seq.calculateIndex(*found));
+
+            int expected = 0;
+            for (amt::MemoryBlock<int>& block : seq.getBlocks())
+            {
+                this->assert_equals(expected, block.data_);
+                ++expected;
+            }
+            this->assert_equals(n, expected);
+            this->assert_equals(static_cast<size_t>(n), seq.getBlocks().size());
+            this->assert_equals(&seq.getBlocks()[0] + n - 1, seq.accessLast());
+        }
+    };
+
     /**
      *  @brief All ImplicitSequenceTests.
      */
@@ -79,6 +121,8 @@ namespace ds::tests
             this->add_test(std::make_unique<GenericSequenceTest<amt::ImplicitSequence<int>>>());
             this->add_test(std::make_unique<ImplicitSequenceTestIndexOfRelative>());
             this->add_test(std::make_unique<CyclicImplicitSequenceTestIndexOfRelative>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::GapImplicitSequence<int>>>());
+            this->add_test(std::make_unique<ImplicitSequenceTestBlocks>());
         }
     };
 }
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <tests/amt/sequence.test.h>
+#include <libds/amt/ring_implicit_sequence.h>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace ds::tests
+{
+    /**
+     *  @brief Tests edits at both ends and in the middle against std::deque.
+     *  \tparam DataT Type of the data in the ring.
+     */
+    template<class DataT>
+    class RingImplicitSequenceTestRandom : public LeafTest
+    {
+    public:
+        explicit RingImplicitSequenceTestRandom(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 3000;
+
+            amt::RingIS<DataT> seq;
+            std::deque<DataT> expected;
+            std::mt19937 rng(3);
+            bool same = true;
+            for (size_t step = 0; step < 4 * n; ++step)
+            {
+                const DataT data = this->makeData(rng());
+                switch (rng() % 6)
+                {
+                case 0:
+                    seq.insertFirst().data_ = data;
+                    expected.push_front(data);
+                    break;
+                case 1:
+                    seq.insertLast().data_ = data;
+                    expected.push_back(data);
+                    break;
+                case 2:
+                {
+                    const size_t index = rng() % (expected.size() + 1);
+                    seq.insert(index).data_ = data;
+                    expected.insert(expected.begin() + index, data);
+                    break;
+                }
+                case 3:
+                    if (!expected.empty())
+                    {
+                        same = same && seq.accessFirst()->data_ == expected.front();
+                        seq.removeFirst();
+                        expected.pop_front();
+                    }
+                    break;
+                case 4:
+                    if (!expected.empty())
+                    {
+                        same = same && seq.accessLast()->data_ == expected.back();
+                        seq.removeLast();
+                        expected.pop_back();
+                    }
+                    break;
+                default:
+                    if (!expected.empty())
+                    {
+                        const size_t index = rng() % expected.size();
+                        seq.remove(index);
+                        expected.erase(expected.begin() + index);
+                    }
+                    break;
+                }
+            }
+
+            this->assert_equals(expected.size(), seq.size());
+            size_t index = 0;
+            seq.forEach([&](amt::MemoryBlock<DataT>* block)
+                {
+                    same = same && block->data_ == expected[index] && seq.calculateIndex(*block) == index;
+                    ++index;
+                });
+            this->assert_true(same, "Blocks match after random edits.");
+
+            amt::RingIS<DataT> copy(seq);
+            this->assert_true(copy.equals(seq), "Copy is equal.");
+        }
+
+    private:
+        DataT makeData(unsigned int value) const
+        {
+            if constexpr (std::is_same_v<DataT, std::string>)
+            {
+                return "string long enough to be on the heap " + std::to_string(value);
+            }
+            else
+            {
+                return static_cast<DataT>(value);
+            }
+        }
+    };
+
+    /**
+     *  @brief Tests that a queue-like use wraps around without growing the ring.
+     */
+    class RingImplicitSequenceTestWrap : public LeafTest
+    {
+    public:
+        RingImplicitSequenceTestWrap() :
+            LeafTest("wrap")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 100;
+
+            amt::RingIS<int> seq(n, false);
+            const size_t capacity = seq.getRingCapacity();
+            for (int i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+
+            bool same = true;
+            for (int i = n; i < 100 * n; ++i)
+            {
+                same = same && seq.accessFirst()->data_ == i - n;
+                seq.removeFirst();
+                seq.insertLast().data_ = i;
+            }
+            this->assert_true(same, "Blocks leave in order of insertion.");
+            this->assert_equals(capacity, seq.getRingCapacity());
+
+            for (int i = 0; i < 10 * n; ++i)
+            {
+                seq.insertFirst().data_ = -i - 1;
+            }
+            this->assert_equals(static_cast<size_t>(11 * n), seq.size());
+            this->assert_equals(-10 * n, seq.accessFirst()->data_);
+            this->assert_equals(99 * n, seq.access(10 * n)->data_);
+            this->assert_equals(100 * n - 1, seq.accessLast()->data_);
+            this->assert_null(seq.accessNext(*seq.accessLast()));
+            this->assert_null(seq.accessPrevious(*seq.accessFirst()));
+        }
+    };
+
+    /**
+     *  @brief Tests that removing a block in front of the first one or behind the last one throws.
+     */
+    class RingImplicitSequenceTestRemoveOutside : public LeafTest
+    {
+    public:
+        RingImplicitSequenceTestRemoveOutside() :
+            LeafTest("remove-outside")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 5;
+
+            amt::RingIS<int> seq;
+            for (int i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+
+            this->assert_throws([&seq]()
+                {
+                    seq.removePrevious(*seq.accessFirst());
+                });
+            this->assert_throws([&seq]()
+                {
+                    seq.removeNext(*seq.accessLast());
+                });
+            this->assert_throws([&seq]()
+                {
+                    seq.removeRange(1, (std::numeric_limits<size_t>::max)());
+                });
+            this->assert_equals(static_cast<size_t>(n), seq.size());
+            this->assert_equals(0, seq.accessFirst()->data_);
+            this->assert_equals(n - 1, seq.accessLast()->data_);
+        }
+    };
+
+    /**
+     *  @brief All RingImplicitSequence tests.
+     */
+    class RingImplicitSequenceTest : public CompositeTest
+    {
+    public:
+        RingImplicitSequenceTest() :
+            CompositeTest("RingImplicitSequence")
+        {
+            this->add_test(std::make_unique<GenericSequenceTest<amt::RingIS<int>>>());
+            this->add_test(std::make_unique<RingImplicitSequenceTestRandom<int>>("random-int"));
+            this->add_test(std::make_unique<RingImplicitSequenceTestRandom<std::string>>("random-string"));
+            this->add_test(std::make_unique<RingImplicitSequenceTestWrap>());
+            this->add_test(std::make_unique<RingImplicitSequenceTestRemoveOutside>());
+        }
+    };
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <tests/amt/sequence.test.h>
+#include <libds/amt/rope_sequence.h>
+#include <libds/mm/pool_memory_manager.h>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     *  @brief Compares the rope with the expected values in both directions.
+     */
+    template<class SequenceT>
+    bool ropeEquals(SequenceT& seq, const std::vector<int>& expected)
+    {
+        if (seq.size() != expected.size())
+        {
+            return false;
+        }
+
+        bool same = true;
+        size_t index = 0;
+        seq.forEach([&](amt::MemoryBlock<int>* block)
+            {
+                same = same && block->data_ == expected[index] && seq.calculateIndex(*block) == index;
+                ++index;
+            });
+        for (amt::MemoryBlock<int>* block = seq.accessLast(); block != nullptr; block = seq.accessPrevious(*block))
+        {
+            --index;
+            same = same && block->data_ == expected[index];
+        }
+        return same && index == 0;
+    }
+
+    /**
+     *  @brief Tests random inserts and removals against std::vector.
+     *  \tparam SequenceT Type of the rope sequence.
+     */
+    template<class SequenceT>
+    class RopeSequenceTestRandom : public LeafTest
+    {
+    public:
+        explicit RopeSequenceTestRandom(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 1000;
+
+            SequenceT seq;
+            std::vector<int> expected;
+            std::mt19937 rng(7);
+            for (size_t step = 0; step < 4 * n; ++step)
+            {
+                if (rng() % 3 != 0 || expected.empty())
+                {
+                    const size_t index = rng() % (expected.size() + 1);
+                    const int data = static_cast<int>(rng());
+                    seq.insert(index).data_ = data;
+                    expected.insert(expected.begin() + index, data);
+                }
+                else
+                {
+                    const size_t index = rng() % expected.size();
+                    seq.remove(index);
+                    expected.erase(expected.begin() + index);
+                }
+            }
+
+            this->assert_true(ropeEquals(seq, expected), "Blocks match after random edits.");
+            this->assert_true(seq.getNodeCount() <= 2 * expected.size() / SequenceT::NODE_CAPACITY + 2, "Nodes stay at least half full.");
+        }
+    };
+
+    /**
+     *  @brief Tests concat, splitAt and insertRange against std::vector.
+     *  \tparam SequenceT Type of the rope sequence.
+     */
+    template<class SequenceT>
+    class RopeSequenceTestSplitConcat : public LeafTest
+    {
+    public:
+        explicit RopeSequenceTestSplitConcat(const std::string& name, bool pooled) :
+            LeafTest(name),
+            pooled_(pooled)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 500;
+
+            std::unique_ptr<SequenceT> seq = this->makeSequence();
+            std::unique_ptr<SequenceT> other = this->makeSequence();
+            std::vector<int> expected;
+            for (int i = 0; i < n; ++i)
+            {
+                seq->insertLast().data_ = i;
+                expected.push_back(i);
+            }
+
+            std::mt19937 rng(11);
+            bool same = true;
+            for (int round = 0; round < 200; ++round)
+            {
+                const size_t index = rng() % (expected.size() + 1);
+                seq->splitAt(index, *other);
+                std::vector<int> tail(expected.begin() + index, expected.end());
+                expected.erase(expected.begin() + index, expected.end());
+                same = same && ropeEquals(*seq, expected) && ropeEquals(*other, tail);
+
+                if (round % 2 == 0)
+                {
+                    seq->concat(*other);
+                    expected.insert(expected.end(), tail.begin(), tail.end());
+                }
+                else
+                {
+                    const size_t at = expected.empty() ? 0 : rng() % expected.size();
+                    seq->insertRange(at, *other);
+                    expected.insert(expected.begin() + at, tail.begin(), tail.end());
+                }
+                same = same && ropeEquals(*seq, expected) && other->size() == 0 && other->accessFirst() == nullptr;
+            }
+            this->assert_true(same, "Parts match after split, concat and insertRange.");
+
+            for (int i = 0; i < n; ++i)
+            {
+                other->insertLast().data_ = -i;
+                expected.insert(expected.begin() + i, -i);
+            }
+            other->concat(*seq);
+            this->assert_true(ropeEquals(*other, expected), "Whole sequence is moved by concat.");
+            this->assert_equals(static_cast<size_t>(0), seq->size());
+
+            this->assert_throws([&other]()
+                {
+                    other->removeRange(1, (std::numeric_limits<size_t>::max)());
+                });
+            this->assert_true(ropeEquals(*other, expected), "Too long range is not removed.");
+
+            seq->concat(*other);
+            seq->clear();
+            this->assert_equals(static_cast<size_t>(0), seq->getNodeCount());
+            this->assert_equals(static_cast<size_t>(0), other->getNodeCount());
+        }
+
+    private:
+        std::unique_ptr<SequenceT> makeSequence() const
+        {
+            return pooled_
+                ? std::make_unique<SequenceT>(new mm::PoolMemoryManager<typename SequenceT::NodeType>(4))
+                : std::make_unique<SequenceT>();
+        }
+
+    private:
+        bool pooled_;
+    };
+
+    /**
+     *  @brief All RopeSequence tests.
+     */
+    class RopeSequenceTest : public CompositeTest
+    {
+    public:
+        RopeSequenceTest() :
+            CompositeTest("RopeSequence")
+        {
+            this->add_test(std::make_unique<GenericSequenceTest<amt::RopeSequence<int, 2>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::RopeSequence<int, 5>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::RopeS<int>>>());
+            this->add_test(std::make_unique<RopeSequenceTestRandom<amt::RopeSequence<int, 4>>>("random-4"));
+            this->add_test(std::make_unique<RopeSequenceTestRandom<amt::RopeS<int>>>("random-64"));
+            this->add_test(std::make_unique<RopeSequenceTestSplitConcat<amt::RopeSequence<int, 3>>>("split-concat-3", false));
+            this->add_test(std::make_unique<RopeSequenceTestSplitConcat<amt::RopeS<int>>>("split-concat-64", false));
+            this->add_test(std::make_unique<RopeSequenceTestSplitConcat<amt::RopeS<int>>>("split-concat-pooled", true));
+        }
+    };
+}
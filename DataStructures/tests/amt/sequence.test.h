@@ -2,7 +2,9 @@
 
 #include <tests/_details/test.hpp>
 #include <libds/amt/sequence.h>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace ds::tests
 {
@@ -371,6 +373,94 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests insertRange, appendN and removeRange.
+     * \tparam SequenceT Type of the sequence. Either explicit or implicit.
+     */
+    template<class SequenceT>
+    class SequenceTestRanges : public LeafTest
+    {
+    public:
+        SequenceTestRanges() :
+            LeafTest("ranges")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 10;
+
+            SequenceT seq;
+            const std::vector<int> values = { 0, 1, 2, 7, 8, 9 };
+            seq.insertRange(0, values.begin(), values.end());
+            const std::vector<int> middle = { 3, 4, 5, 6 };
+            seq.insertRange(3, middle.begin(), middle.end());
+            seq.insertRange(seq.size(), middle.end(), middle.end());
+            // 0 1 2 3 4 5 6 7 8 9
+
+            this->assert_equals(static_cast<size_t>(n), seq.size());
+            this->assert_true(this->matches(seq, 0, n), "Inserted range is in order.");
+
+            auto* appended = seq.appendN(n);
+            for (int i = n; i < 2 * n; ++i)
+            {
+                appended->data_ = i;
+                appended = seq.accessNext(*appended);
+            }
+            this->assert_equals(static_cast<size_t>(2 * n), seq.size());
+            this->assert_true(this->matches(seq, 0, 2 * n), "Appended blocks are behind the last one.");
+
+            seq.removeRange(0, 2);
+            seq.removeRange(seq.size() - 2, 2);
+            seq.removeRange(4, 8);
+            seq.removeRange(1, 0);
+            // 2 3 4 5 14 15 16 17
+            this->assert_equals(static_cast<size_t>(8), seq.size());
+            this->assert_true(this->matches(seq, 2, 4), "Blocks in front of the removed range stay.");
+            this->assert_equals(14, seq.access(4)->data_);
+            this->assert_equals(17, seq.accessLast()->data_);
+
+            this->assert_throws([&seq]()
+                {
+                    seq.removeRange(2, (std::numeric_limits<size_t>::max)());
+                });
+            this->assert_throws([&seq]()
+                {
+                    seq.removeRange(seq.size() + 1, 0);
+                });
+            this->assert_equals(static_cast<size_t>(8), seq.size());
+
+            seq.removeRange(0, seq.size());
+            this->assert_equals(static_cast<size_t>(0), seq.size());
+            this->assert_null(seq.accessFirst());
+            this->assert_null(seq.accessLast());
+
+            seq.insertRange(0, middle.begin(), middle.end());
+            this->assert_true(this->matches(seq, 3, 4), "Range is inserted into an empty sequence.");
+        }
+
+    private:
+        bool matches(SequenceT& seq, int first, int count)
+        {
+            bool result = true;
+            auto* block = seq.accessFirst();
+            for (int i = 0; i < count; ++i)
+            {
+                result = result && block != nullptr && block->data_ == first + i;
+                block = result ? seq.accessNext(*block) : nullptr;
+            }
+
+            block = seq.access(static_cast<size_t>(count - 1));
+            for (int i = count - 1; i >= 0; --i)
+            {
+                result = result && block != nullptr && block->data_ == first + i;
+                block = result ? seq.accessPrevious(*block) : nullptr;
+            }
+            return result;
+        }
+    };
+
     /**
      * @brief Tests removal of next to block element.
      * \tparam SequenceT Type of the sequence. Either explicit or implicit.
@@ -525,6 +615,174 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests processing of all elements after an edit in the middle.
+     * \tparam SequenceT Type of the sequence. Either explicit or implicit.
+     */
+    template<class SequenceT>
+    class SequenceTestProcessAll : public LeafTest
+    {
+    public:
+        SequenceTestProcessAll() :
+            LeafTest("processAll")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 10;
+
+            SequenceT seq;
+            for (int i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+            seq.remove(n / 2);
+            seq.insert(n / 2).data_ = n / 2;
+            // 0 1 2 3 4 5 6 7 8 9
+
+            int processed = 0;
+            seq.processAllBlocksForward([this, &processed](const amt::MemoryBlock<int>* block)
+                {
+                    this->assert_equals(processed, block->data_);
+                    ++processed;
+                });
+            this->assert_equals(n, processed);
+
+            processed = 0;
+            seq.processAllBlocksBackward([this, &processed, n](const amt::MemoryBlock<int>* block)
+                {
+                    this->assert_equals(n - processed - 1, block->data_);
+                    ++processed;
+                });
+            this->assert_equals(n, processed);
+        }
+    };
+
+    /**
+     * @brief Tests templated traversal and search.
+     * \tparam SequenceT Type of the sequence. Either explicit or implicit.
+     */
+    template<class SequenceT>
+    class SequenceTestForEach : public LeafTest
+    {
+    public:
+        SequenceTestForEach() :
+            LeafTest("forEach")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 10;
+
+            SequenceT seq;
+            for (int i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+            // 0 1 2 3 4 5 6 7 8 9
+
+            int processed = 0;
+            seq.forEach([this, &processed](amt::MemoryBlock<int>* block)
+                {
+                    this->assert_equals(processed, block->data_);
+                    block->data_ *= 2;
+                    ++processed;
+                });
+            this->assert_equals(n, processed);
+            // 0 2 4 6 8 10 12 14 16 18
+
+            processed = 0;
+            seq.forEachBackward([this, &processed, n](const amt::MemoryBlock<int>* block)
+                {
+                    this->assert_equals(2 * (n - processed - 1), block->data_);
+                    ++processed;
+                });
+            this->assert_equals(n, processed);
+
+            amt::MemoryBlock<int>* found = seq.findBlock([](const amt::MemoryBlock<int>* block) { return block->data_ > 7; });
+            this->assert_true(found != nullptr, "Block was found.");
+            this->assert_equals(8, found->data_);
+            this->assert_true(seq.access(4) == found, "Found block is the fifth one.");
+
+            found = seq.findBlock([](const amt::MemoryBlock<int>* block) { return block->data_ % 2 == 1; });
+            this->assert_null(found);
+
+            SequenceT empty;
+            empty.forEach([this](amt::MemoryBlock<int>*) { this->fail("Empty sequence has no blocks."); });
+            this->assert_null(empty.findBlock([](amt::MemoryBlock<int>*) { return true; }));
+        }
+    };
+
+    /**
+     * @brief Tests operations of a sequence called without virtual dispatch.
+     * \tparam SequenceT Type of the sequence. Either explicit or implicit.
+     */
+    template<class SequenceT>
+    class SequenceTestStaticDispatch : public LeafTest
+    {
+    public:
+        SequenceTestStaticDispatch() :
+            LeafTest("staticDispatch")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 10;
+
+            SequenceT seq;
+            const amt::StaticSequence<SequenceT> dispatch(&seq);
+            this->assert_true(dispatch.isEmpty(), "New sequence is empty.");
+
+            for (int i = 1; i < n - 1; ++i)
+            {
+                dispatch.insertLast().data_ = i;
+            }
+            dispatch.insertFirst().data_ = 0;
+            dispatch.insertAfter(*dispatch.accessLast()).data_ = n - 1;
+            // 0 1 2 3 4 5 6 7 8 9
+
+            this->assert_equals(static_cast<size_t>(n), dispatch.size());
+            this->assert_equals(seq.size(), dispatch.size());
+
+            int expected = 0;
+            dispatch.forEach([this, &expected](amt::MemoryBlock<int>* block)
+                {
+                    this->assert_equals(expected, block->data_);
+                    ++expected;
+                });
+            this->assert_equals(n, expected);
+
+            for (int i = 0; i < n; ++i)
+            {
+                this->assert_equals(i, dispatch.access(i)->data_);
+                this->assert_equals(static_cast<size_t>(i), dispatch.calculateIndex(*dispatch.access(i)));
+            }
+
+            this->assert_equals(5, dispatch.accessNext(*dispatch.access(4))->data_);
+            this->assert_equals(seq.access(7), dispatch.findBlock([](amt::MemoryBlock<int>* block) { return block->data_ == 7; }));
+
+            dispatch.removeFirst();
+            dispatch.removeLast();
+            dispatch.remove(3);
+            dispatch.removeNext(*dispatch.accessFirst());
+            // 1 3 5 6 7 8
+            const auto order = { 1, 3, 5, 6, 7, 8 };
+            auto orderIt = begin(order);
+            for (auto data : seq)
+            {
+                this->assert_equals(*orderIt, data);
+                ++orderIt;
+            }
+            this->assert_equals(static_cast<size_t>(6), dispatch.size());
+        }
+    };
+
     /**
      * @brief Tests finding a block with property.
      * \tparam SequenceT Type of the sequence. Either explicit or implicit.
@@ -730,15 +988,19 @@ namespace ds::tests
     /**
      * @brief All generic sequence leaf tests.
      * \tparam SequenceT Type of the sequence. Either explicit or implicit.
+     * \tparam AnyBlockIndex False if calculateIndex of the sequence cannot take an arbitrary pointer.
      */
-    template<class SequenceT>
+    template<class SequenceT, bool AnyBlockIndex = true>
     class GenericSequenceTest : public CompositeTest
     {
     public:
         GenericSequenceTest() :
             CompositeTest("GenericSequenceTest")
         {
-            this->add_test(std::make_unique<SequenceTestCalculateIndex<SequenceT>>());
+            if constexpr (AnyBlockIndex)
+            {
+                this->add_test(std::make_unique<SequenceTestCalculateIndex<SequenceT>>());
+            }
             this->add_test(std::make_unique<SequenceTestInsertEnds<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestInsertRandom<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestInsertBefore<SequenceT>>());
@@ -750,8 +1012,12 @@ namespace ds::tests
             this->add_test(std::make_unique<SequenceTestRemoveRandom<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestRemoveNext<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestRemovePrevious<SequenceT>>());
+            this->add_test(std::make_unique<SequenceTestRanges<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestProcessForward<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestProcessBackward<SequenceT>>());
+            this->add_test(std::make_unique<SequenceTestProcessAll<SequenceT>>());
+            this->add_test(std::make_unique<SequenceTestForEach<SequenceT>>());
+            this->add_test(std::make_unique<SequenceTestStaticDispatch<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestFindWithProperty<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestFindPrevToWithProperty<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestIterators<SequenceT>>());
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <tests/amt/sequence.test.h>
+#include <tests/amt/explicit_sequence.test.h>
+#include <libds/amt/skip_list_sequence.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     *  @brief Tests positional operations against std::vector.
+     */
+    class SkipListSequenceTestIndices : public LeafTest
+    {
+    public:
+        SkipListSequenceTestIndices() :
+            LeafTest("indices")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 2000;
+
+            amt::SkipListSequence<int> seq;
+            std::vector<int> expected;
+            std::mt19937 rng(11);
+            for (size_t step = 0; step < 4 * n; ++step)
+            {
+                if (rng() % 3 != 0 || expected.empty())
+                {
+                    const size_t index = rng() % (expected.size() + 1);
+                    const int data = static_cast<int>(rng());
+                    seq.insert(index).data_ = data;
+                    expected.insert(expected.begin() + index, data);
+                }
+                else
+                {
+                    const size_t index = rng() % expected.size();
+                    seq.remove(index);
+                    expected.erase(expected.begin() + index);
+                }
+            }
+
+            this->assert_equals(expected.size(), seq.size());
+            this->assert_true(seq.getHeight() > 1, "Skip list has express levels.");
+
+            bool same = true;
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                amt::SkipListSequenceBlock<int>* block = seq.access(i);
+                same = same && block->data_ == expected[i] && seq.calculateIndex(*block) == i;
+            }
+            this->assert_true(same, "Access and calculateIndex match after random edits.");
+
+            size_t index = expected.size();
+            for (amt::SkipListSequenceBlock<int>* block = seq.accessLast(); block != nullptr; block = seq.accessPrevious(*block))
+            {
+                --index;
+                same = same && block->data_ == expected[index];
+            }
+            this->assert_true(same, "Backward traversal matches.");
+            this->assert_null(seq.access(expected.size()));
+
+            seq.clear();
+            this->assert_equals(static_cast<size_t>(1), seq.getHeight());
+            seq.insertLast().data_ = 1;
+            seq.insertFirst().data_ = 0;
+            this->assert_equals(static_cast<size_t>(1), seq.calculateIndex(*seq.accessLast()));
+        }
+    };
+
+    /**
+     *  @brief Tests calculateIndex of own blocks and blocks of another list.
+     */
+    class SkipListSequenceTestCalculateIndex : public LeafTest
+    {
+    public:
+        SkipListSequenceTestCalculateIndex() :
+            LeafTest("calculateIndex")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 500;
+
+            amt::SkipListSequence<int> seq;
+            amt::SkipListSequence<int> other;
+            for (size_t i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = static_cast<int>(i);
+                other.insertLast().data_ = static_cast<int>(i);
+            }
+
+            bool own = true;
+            bool foreign = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                own = own && seq.calculateIndex(*seq.access(i)) == i;
+                foreign = foreign && seq.calculateIndex(*other.access(i)) == INVALID_INDEX;
+            }
+            this->assert_true(own, "Index of own blocks.");
+            this->assert_true(foreign, "Blocks of another list are not found.");
+        }
+    };
+
+    /**
+     *  @brief All SkipListSequence tests.
+     */
+    class SkipListSequenceTest : public CompositeTest
+    {
+    public:
+        SkipListSequenceTest() :
+            CompositeTest("SkipListSequence")
+        {
+            this->add_test(std::make_unique<GenericSequenceTest<amt::SkipListSequence<int>, false>>());
+            this->add_test(std::make_unique<GenericSequenceTest<details::ManagedSequence<amt::SkipListSequence<int>, mm::PoolMemoryManager>, false>>());
+            this->add_test(std::make_unique<SkipListSequenceTestCalculateIndex>());
+            this->add_test(std::make_unique<SkipListSequenceTestIndices>());
+        }
+    };
+}
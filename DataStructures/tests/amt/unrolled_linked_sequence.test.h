@@ -0,0 +1,115 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <tests/amt/sequence.test.h>
+#include <libds/amt/unrolled_linked_sequence.h>
+#include <libds/mm/pool_memory_manager.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     *  @brief Tests splitting and merging of nodes against std::vector.
+     *  Nodes are allocated by a pool or one by one on the heap, which on MSVC
+     *  goes through new of the heap monitor.
+     *  \tparam SequenceT Type of the unrolled linked sequence.
+     */
+    template<class SequenceT>
+    class UnrolledLinkedSequenceTestNodes : public LeafTest
+    {
+    public:
+        explicit UnrolledLinkedSequenceTestNodes(const std::string& name, bool pooled) :
+            LeafTest(name),
+            pooled_(pooled)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 1000;
+            constexpr size_t capacity = SequenceT::NODE_CAPACITY;
+
+            using NodeType = typename SequenceT::NodeType;
+            SequenceT seq(pooled_ ? new mm::PoolMemoryManager<NodeType>(8) : new mm::MemoryManager<NodeType>());
+            std::vector<int> expected;
+            for (size_t i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = static_cast<int>(i);
+                expected.push_back(static_cast<int>(i));
+            }
+            this->assert_equals((n + capacity - 1) / capacity, seq.getNodeCount());
+
+            std::mt19937 rng(7);
+            for (size_t step = 0; step < 4 * n; ++step)
+            {
+                if (rng() % 2 == 0 || expected.empty())
+                {
+                    const size_t index = rng() % (expected.size() + 1);
+                    const int data = static_cast<int>(rng());
+                    seq.insert(index).data_ = data;
+                    expected.insert(expected.begin() + index, data);
+                }
+                else
+                {
+                    const size_t index = rng() % expected.size();
+                    seq.remove(index);
+                    expected.erase(expected.begin() + index);
+                }
+            }
+
+            this->assert_equals(expected.size(), seq.size());
+            this->assert_true(seq.getNodeCount() <= 2 * expected.size() / capacity + 1, "Nodes are at least half full on average.");
+
+            bool same = true;
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                amt::MemoryBlock<int>* block = seq.access(i);
+                same = same && block->data_ == expected[i] && seq.calculateIndex(*block) == i;
+            }
+            this->assert_true(same, "Blocks match after random edits.");
+
+            size_t index = 0;
+            for (amt::MemoryBlock<int>* block = seq.accessFirst(); block != nullptr; block = seq.accessNext(*block))
+            {
+                same = same && block->data_ == expected[index];
+                ++index;
+            }
+            for (amt::MemoryBlock<int>* block = seq.accessLast(); block != nullptr; block = seq.accessPrevious(*block))
+            {
+                --index;
+                same = same && block->data_ == expected[index];
+            }
+            this->assert_true(same, "Traversal crosses node boundaries.");
+
+            while (!seq.isEmpty())
+            {
+                seq.removeFirst();
+            }
+            this->assert_equals(static_cast<size_t>(0), seq.getNodeCount());
+        }
+
+    private:
+        bool pooled_;
+    };
+
+    /**
+     *  @brief All UnrolledLinkedSequence tests.
+     */
+    class UnrolledLinkedSequenceTest : public CompositeTest
+    {
+    public:
+        UnrolledLinkedSequenceTest() :
+            CompositeTest("UnrolledLinkedSequence")
+        {
+            this->add_test(std::make_unique<GenericSequenceTest<amt::UnrolledLinkedSequence<int, 2>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::UnrolledLinkedSequence<int, 3>>>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::UnrolledLS<int>>>());
+            this->add_test(std::make_unique<UnrolledLinkedSequenceTestNodes<amt::UnrolledLinkedSequence<int, 4>>>("nodes-4", true));
+            this->add_test(std::make_unique<UnrolledLinkedSequenceTestNodes<amt::UnrolledLinkedSequence<int, 33>>>("nodes-33", true));
+            this->add_test(std::make_unique<UnrolledLinkedSequenceTestNodes<amt::UnrolledLS<int>>>("nodes-32-heap", false));
+        }
+    };
+}
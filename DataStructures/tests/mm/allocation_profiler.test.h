@@ -0,0 +1,145 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/allocation_profiler.h>
+#include <libds/mm/memory_manager.h>
+#include <libds/amt/explicit_sequence.h>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+
+namespace ds::tests
+{
+#ifdef DS_MM_PROFILER
+
+    /**
+     * @brief Tests counters of a site and reports of a profiler.
+     */
+    class AllocationProfilerTestSite : public LeafTest
+    {
+    public:
+        AllocationProfilerTestSite() :
+            LeafTest("site")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::AllocationProfiler profiler;
+            mm::AllocationSite* site = nullptr;
+            {
+                mm::ProfilerScope outer("outer");
+                mm::ProfilerScope inner("inner");
+                site = profiler.getSite(typeid(int));
+                this->assert_true(site == profiler.getSite(typeid(int)), "Same scopes give same site.");
+            }
+            this->assert_true(site != profiler.getSite(typeid(int)), "Other scopes give other site.");
+
+            site->recordAllocation(3, sizeof(int));
+            site->recordRelease(2, sizeof(int));
+            site->recordAllocation(1, sizeof(int));
+            this->assert_equals(static_cast<size_t>(4), site->getAllocationCount());
+            this->assert_equals(static_cast<size_t>(2), site->getReleaseCount());
+            this->assert_equals(4 * sizeof(int), site->getAllocatedBytes());
+            this->assert_equals(2 * sizeof(int), site->getLiveBytes());
+            this->assert_equals(3 * sizeof(int), site->getPeakBytes());
+            this->assert_equals(3 * sizeof(int), profiler.getPeakBytes());
+
+            std::ostringstream leaks;
+            this->assert_true(profiler.reportLeaks(leaks), "Live blocks are reported as leak.");
+            this->assert_true(leaks.str().find(site->getName()) != std::string::npos, "Leak names the site.");
+
+            site->recordRelease(2, sizeof(int));
+            std::ostringstream noLeaks;
+            this->assert_false(profiler.reportLeaks(noLeaks), "No leak after all blocks are released.");
+            this->assert_equals(static_cast<size_t>(0), profiler.getLiveBytes());
+
+            std::ostringstream folded;
+            profiler.writeFoldedStacks(folded);
+            this->assert_equals(site->getName() + " " + std::to_string(3 * sizeof(int)) + "\n", folded.str());
+            this->assert_equals(std::string("outer;inner;"), site->getName().substr(0, 12));
+        }
+    };
+
+    /**
+     * @brief Tests allocations reported by memory managers.
+     */
+    class AllocationProfilerTestManagers : public LeafTest
+    {
+    public:
+        AllocationProfilerTestManagers() :
+            LeafTest("managers")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::ProfilerScope scope("allocation-profiler-test");
+            mm::AllocationSite* site = mm::AllocationProfiler::getInstance().getSite(typeid(int));
+            const size_t allocated = site->getAllocatedBytes();
+            {
+                mm::MemoryManager<int> manager;
+                int* first = manager.allocateMemory();
+                int* second = manager.allocateMemory();
+                this->assert_equals(allocated + 2 * sizeof(int), site->getAllocatedBytes());
+                this->assert_equals(2 * sizeof(int), site->getLiveBytes());
+                manager.releaseMemory(first);
+                manager.releaseMemory(second);
+            }
+            this->assert_equals(static_cast<size_t>(0), site->getLiveBytes());
+
+            {
+                amt::SinglyLS<int> sequence;
+                sequence.insertLast();
+                sequence.insertLast();
+            }
+            std::ostringstream folded;
+            mm::AllocationProfiler::getInstance().writeFoldedStacks(folded);
+            this->assert_true(folded.str().find("allocation-profiler-test;") != std::string::npos, "Structure is attributed to the scope.");
+        }
+    };
+
+#else
+
+    /**
+     * @brief Tests that memory managers carry no profiler data when it is switched off.
+     */
+    class AllocationProfilerTestDisabled : public LeafTest
+    {
+    public:
+        AllocationProfilerTestDisabled() :
+            LeafTest("disabled")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            DS_MM_PROFILE_SCOPE("allocation-profiler-test");
+            this->assert_false(mm::AllocationProfilerHook<int>::ENABLED, "Hook is switched off.");
+            this->assert_true(std::is_empty_v<mm::AllocationProfilerHook<int>>, "Hook adds no data.");
+        }
+    };
+
+#endif
+
+    /**
+     * @brief All AllocationProfiler tests.
+     */
+    class AllocationProfilerTest : public CompositeTest
+    {
+    public:
+        AllocationProfilerTest() :
+            CompositeTest("AllocationProfiler")
+        {
+#ifdef DS_MM_PROFILER
+            this->add_test(std::make_unique<AllocationProfilerTestSite>());
+            this->add_test(std::make_unique<AllocationProfilerTestManagers>());
+#else
+            this->add_test(std::make_unique<AllocationProfilerTestDisabled>());
+#endif
+        }
+    };
+}
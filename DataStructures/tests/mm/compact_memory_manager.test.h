@@ -2,7 +2,12 @@
 
 #include <tests/_details/test.hpp>
 #include <libds/mm/compact_memory_manager.h>
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
 
 namespace ds::tests
 {
@@ -29,6 +34,11 @@ namespace ds::tests
             }
 
             this->assert_equals(static_cast<std::size_t>(n), manager.getAllocatedBlockCount());
+            this->assert_true(manager.getCapacity() >= manager.getAllocatedBlockCount(), "Capacity covers allocated blocks.");
+
+            manager.changeCapacity(2 * n);
+            this->assert_equals(static_cast<std::size_t>(2 * n), manager.getCapacity());
+            this->assert_equals(static_cast<std::size_t>(n), manager.getAllocatedBlockCount());
         }
     };
 
@@ -352,6 +362,289 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests moving and copying of blocks which are not trivially copyable.
+     */
+    class CompactMemoryManagerTestNonTrivial : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestNonTrivial() :
+            LeafTest("nonTrivial")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 20;
+            const std::string prefix = "string long enough to be on the heap ";
+
+            mm::CompactMemoryManager<std::string> manager(1);
+            for (int i = 0; i < n; ++i)
+            {
+                *manager.allocateMemoryAt(0) = prefix + std::to_string(n - i - 1);
+            }
+            manager.releaseMemoryAt(0);
+            *manager.allocateMemoryAt(0) = prefix + "0";
+
+            mm::CompactMemoryManager<std::string> copy;
+            copy.assign(manager);
+            manager.changeCapacity(n / 2);
+
+            this->assert_equals(static_cast<size_t>(n / 2), manager.getAllocatedBlockCount());
+            this->assert_equals(static_cast<size_t>(n), copy.getAllocatedBlockCount());
+            for (int i = 0; i < n; ++i)
+            {
+                const std::string expected = prefix + std::to_string(i);
+                this->assert_equals(expected, copy.getBlockAt(i));
+                if (i < n / 2)
+                {
+                    this->assert_equals(expected, manager.getBlockAt(i));
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Tests memory reserved as a virtual memory region.
+     */
+    class CompactMemoryManagerTestVirtualMemory : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestVirtualMemory() :
+            LeafTest("virtualMemory")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 100000;
+
+            mm::VirtualMemoryRegion* region = new mm::VirtualMemoryRegion(n * sizeof(int), true);
+            const size_t reservedCount = region->getReservedSize() / sizeof(int);
+            mm::CompactMemoryManager<int> manager(0, new mm::GeometricGrowthPolicy(), region);
+            int* first = manager.allocateMemory();
+            *first = 0;
+            for (int i = 1; i < n; ++i)
+            {
+                *manager.allocateMemory() = i;
+            }
+
+            this->assert_equals(first, &manager.getBlockAt(0));
+
+            mm::CompactMemoryManager<int> copy(manager);
+            this->assert_true(copy.equals(manager), "Copy is equal.");
+
+            manager.changeCapacity(n / 2);
+            manager.shrinkMemory();
+            this->assert_equals(first, &manager.getBlockAt(0));
+            this->assert_equals(static_cast<size_t>(n / 2), manager.getAllocatedBlockCount());
+            for (int i = 0; i < n; ++i)
+            {
+                this->assert_equals(i, copy.getBlockAt(i));
+            }
+
+            bool overflowed = false;
+            try
+            {
+                for (size_t i = n; i <= reservedCount; ++i)
+                {
+                    copy.allocateMemory();
+                }
+            }
+            catch (const std::bad_alloc&)
+            {
+                overflowed = true;
+            }
+            this->assert_true(overflowed, "Reserved memory cannot be exceeded.");
+
+            this->assert_throws([reservedCount]()
+                {
+                    // the region and the policy are released by the failing constructor
+                    mm::CompactMemoryManager<int> tooLarge(
+                        2 * reservedCount, new mm::GeometricGrowthPolicy(), new mm::VirtualMemoryRegion(reservedCount * sizeof(int), false));
+                });
+        }
+    };
+
+    /**
+     * @brief Tests alignment of the memory.
+     */
+    class CompactMemoryManagerTestAlignment : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestAlignment() :
+            LeafTest("alignment")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 1000;
+            const size_t alignment = 64;
+
+            mm::CompactMemoryManager<int> manager(1, new mm::GeometricGrowthPolicy(1.5), alignment);
+            this->assert_equals(alignment, manager.getAlignment());
+            for (int i = 0; i < n; ++i)
+            {
+                *manager.allocateMemory() = i;
+                this->assert_equals(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(&manager.getBlockAt(0)) % alignment);
+            }
+
+            mm::CompactMemoryManager<int> copy(manager);
+            this->assert_equals(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(&copy.getBlockAt(0)) % alignment);
+
+            manager.shrinkMemory();
+            this->assert_equals(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(&manager.getBlockAt(0)) % alignment);
+            for (int i = 0; i < n; ++i)
+            {
+                this->assert_equals(i, manager.getBlockAt(i));
+                this->assert_equals(i, copy.getBlockAt(i));
+            }
+
+            bool rejected = false;
+            try
+            {
+                mm::CompactMemoryManager<int> invalid(1, new mm::GeometricGrowthPolicy(1.5), 3 * alignment);
+            }
+            catch (const std::bad_alloc&)
+            {
+                rejected = true;
+            }
+            this->assert_true(rejected, "Alignment that is not a power of two is rejected.");
+        }
+    };
+
+    /**
+     * @brief Tests edits around a cursor in the gap buffer mode.
+     */
+    class CompactMemoryManagerTestGapBuffer : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestGapBuffer() :
+            LeafTest("gapBuffer")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::CompactMemoryManager<std::string> manager;
+            manager.useGapBuffer(true);
+            std::vector<std::string> expected;
+
+            std::default_random_engine rng(42);
+            size_t cursor = 0;
+            for (int i = 0; i < 2000; ++i)
+            {
+                const size_t size = expected.size();
+                cursor = std::uniform_int_distribution<size_t>(cursor > 3 ? cursor - 3 : 0, (std::min)(cursor + 3, size))(rng);
+                if (size > 0 && rng() % 3 == 0)
+                {
+                    cursor = (std::min)(cursor, size - 1);
+                    manager.releaseMemoryAt(cursor);
+                    expected.erase(expected.begin() + cursor);
+                }
+                else
+                {
+                    manager.allocateMemoryAt(cursor)->assign(std::to_string(i));
+                    expected.insert(expected.begin() + cursor, std::to_string(i));
+                }
+            }
+
+            this->assert_true(manager.usesGapBuffer(), "Gap buffer is used.");
+            this->assert_equals(expected.size(), manager.getAllocatedBlockCount());
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                this->assert_equals(expected[i], manager.getBlockAt(i));
+                this->assert_equals(i, manager.calculateIndex(manager.getBlockAt(i)));
+            }
+
+            mm::CompactMemoryManager<std::string> copy(manager);
+            this->assert_true(copy.usesGapBuffer(), "Copy uses gap buffer.");
+            manager.releaseMemory();
+            expected.pop_back();
+            manager.useGapBuffer(false);
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                this->assert_equals(expected[i], manager.getBlockAt(i));
+                this->assert_equals(expected[i], copy.getBlockAt(i));
+            }
+
+            mm::CompactMemoryManager<int> numbers;
+            numbers.useGapBuffer(true);
+            for (int i = 0; i < 100; ++i)
+            {
+                *numbers.allocateMemoryAt(i / 2) = i;
+            }
+            mm::CompactMemoryManager<int> numbersCopy(numbers);
+            this->assert_true(numbers.equals(numbersCopy), "Copy of gap buffer is equal.");
+            numbers.releaseMemory(&numbers.getBlockAt(50));
+            this->assert_equals(static_cast<size_t>(50), numbers.getAllocatedBlockCount());
+            for (size_t i = 0; i < 50; ++i)
+            {
+                this->assert_equals(numbersCopy.getBlockAt(i), numbers.getBlockAt(i));
+            }
+        }
+    };
+
+    /**
+     * @brief Tests allocation and release of several blocks at once, with and without the gap buffer.
+     */
+    class CompactMemoryManagerTestRange : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestRange() :
+            LeafTest("range")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            for (const bool gapBuffer : { false, true })
+            {
+                mm::CompactMemoryManager<std::string> manager;
+                manager.useGapBuffer(gapBuffer);
+                std::vector<std::string> expected;
+
+                std::default_random_engine rng(7);
+                for (int i = 0; i < 300; ++i)
+                {
+                    const size_t size = expected.size();
+                    const size_t index = std::uniform_int_distribution<size_t>(0, size)(rng);
+                    const size_t count = std::uniform_int_distribution<size_t>(1, 20)(rng);
+                    if (size > 0 && rng() % 3 == 0)
+                    {
+                        const size_t removed = (std::min)(count, size - (std::min)(index, size - 1));
+                        const size_t from = (std::min)(index, size - 1);
+                        manager.releaseMemoryAt(from, removed);
+                        expected.erase(expected.begin() + from, expected.begin() + from + removed);
+                    }
+                    else
+                    {
+                        std::string* blocks = manager.allocateMemoryAt(index, count);
+                        for (size_t j = 0; j < count; ++j)
+                        {
+                            blocks[j] = "string long enough to be on the heap " + std::to_string(i) + "." + std::to_string(j);
+                            expected.insert(expected.begin() + index + j, blocks[j]);
+                        }
+                    }
+                }
+
+                this->assert_equals(expected.size(), manager.getAllocatedBlockCount());
+                bool same = true;
+                for (size_t i = 0; i < expected.size(); ++i)
+                {
+                    same = same && expected[i] == manager.getBlockAt(i);
+                }
+                this->assert_true(same, gapBuffer ? "Blocks match with gap buffer." : "Blocks match.");
+            }
+        }
+    };
+
     /**
      * @brief All CompactMemoryManager leaf tests.
      */
@@ -372,6 +665,11 @@ namespace ds::tests
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateAddress>());
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateIndex>());
             this->add_test(std::make_unique<CompactMemoryManagerSwap>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestNonTrivial>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestVirtualMemory>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestAlignment>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestGapBuffer>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestRange>());
         }
     };
 }
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/growth_policy.h>
+#include <libds/mm/compact_memory_manager.h>
+#include <memory>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests capacities returned by growth policies.
+     */
+    class GrowthPolicyTestGrow : public LeafTest
+    {
+    public:
+        GrowthPolicyTestGrow() :
+            LeafTest("grow")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const mm::GeometricGrowthPolicy doubling;
+            const mm::GeometricGrowthPolicy halfGrowth(1.5);
+            const mm::FixedIncrementGrowthPolicy increment(100);
+            const mm::SizeClassGrowthPolicy sizeClass;
+            const mm::HugePageGrowthPolicy hugePage(4096);
+
+            this->assert_equals(static_cast<size_t>(20), doubling.grow(10, 11, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(15), halfGrowth.grow(10, 11, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(110), increment.grow(10, 11, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(1), doubling.grow(0, 1, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(50), doubling.grow(10, 50, sizeof(int)));
+
+            this->assert_equals(static_cast<size_t>(16), mm::SizeClassGrowthPolicy::sizeClass(10));
+            this->assert_equals(static_cast<size_t>(128), mm::SizeClassGrowthPolicy::sizeClass(128));
+            this->assert_equals(static_cast<size_t>(160), mm::SizeClassGrowthPolicy::sizeClass(129));
+            this->assert_equals(static_cast<size_t>(640), mm::SizeClassGrowthPolicy::sizeClass(600));
+            this->assert_equals(static_cast<size_t>(32), sizeClass.grow(20, 21, sizeof(int)));
+
+            this->assert_equals(static_cast<size_t>(20), hugePage.grow(10, 11, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(2048), hugePage.grow(800, 801, sizeof(int)));
+        }
+    };
+
+    /**
+     * @brief Tests capacities returned when memory is released.
+     */
+    class GrowthPolicyTestShrink : public LeafTest
+    {
+    public:
+        GrowthPolicyTestShrink() :
+            LeafTest("shrink")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const mm::GeometricGrowthPolicy keeping;
+            const mm::GeometricGrowthPolicy shrinking(2.0, true);
+
+            this->assert_equals(static_cast<size_t>(7), keeping.shrink(7, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(100), keeping.shrinkAfterRelease(100, 10, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(100), shrinking.shrinkAfterRelease(100, 26, sizeof(int)));
+            this->assert_equals(static_cast<size_t>(50), shrinking.shrinkAfterRelease(100, 25, sizeof(int)));
+        }
+    };
+
+    /**
+     * @brief Tests compact memory manager with every growth policy.
+     */
+    class GrowthPolicyTestCompactMemoryManager : public LeafTest
+    {
+    public:
+        GrowthPolicyTestCompactMemoryManager() :
+            LeafTest("compact-memory-manager")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            this->testPolicy(new mm::GeometricGrowthPolicy(1.5, true));
+            this->testPolicy(new mm::FixedIncrementGrowthPolicy(7, true));
+            this->testPolicy(new mm::SizeClassGrowthPolicy(1.5, true));
+            this->testPolicy(new mm::HugePageGrowthPolicy(256, 2.0, true));
+        }
+
+    private:
+        void testPolicy(mm::GrowthPolicy* policy)
+        {
+            mm::CompactMemoryManager<int> manager(0, policy);
+            const int n = 100;
+
+            for (int i = 0; i < n; ++i)
+            {
+                *manager.allocateMemory() = i;
+            }
+
+            mm::CompactMemoryManager<int> copy(manager);
+            this->assert_true(copy.equals(manager), "Copy is equal.");
+
+            const size_t reservedFull = manager.getStatistics().reservedBytes_;
+            for (int i = 0; i < n - 10; ++i)
+            {
+                manager.releaseMemoryAt(0);
+            }
+
+            this->assert_equals(static_cast<size_t>(10), manager.getAllocatedBlockCount());
+            for (int i = 0; i < 10; ++i)
+            {
+                this->assert_equals(n - 10 + i, manager.getBlockAt(i));
+            }
+
+            if (mm::MemoryStatisticsRecorder<int>::ENABLED)
+            {
+                this->assert_true(manager.getStatistics().reservedBytes_ < reservedFull, "Memory was given back.");
+            }
+
+            manager.shrinkMemory();
+            this->assert_equals(static_cast<size_t>(10), manager.getAllocatedBlockCount());
+            this->assert_equals(n - 1, manager.getBlockAt(9));
+        }
+    };
+
+    /**
+     * @brief All GrowthPolicy tests.
+     */
+    class GrowthPolicyTest : public CompositeTest
+    {
+    public:
+        GrowthPolicyTest() :
+            CompositeTest("GrowthPolicy")
+        {
+            this->add_test(std::make_unique<GrowthPolicyTestGrow>());
+            this->add_test(std::make_unique<GrowthPolicyTestShrink>());
+            this->add_test(std::make_unique<GrowthPolicyTestCompactMemoryManager>());
+        }
+    };
+}
@@ -2,6 +2,8 @@
 
 #include <tests/_details/test.hpp>
 #include <tests/mm/memory_manager.test.h>
+#include <libds/mm/pool_memory_manager.h>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -84,6 +86,75 @@ namespace ds::tests
         }
     };
 
+    class MemoryManagerTestAdopt : public LeafTest
+    {
+    public:
+        MemoryManagerTestAdopt() :
+            LeafTest("adopt")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::MemoryManager<int> manager;
+            mm::MemoryManager<int> other;
+            mm::PoolMemoryManager<int> pool;
+            int* ip = other.allocateMemory();
+            int* pp = pool.allocateMemory();
+
+            this->assert_true(manager.adoptBlocks(other, 1), "Heap blocks are adopted.");
+            this->assert_equals(static_cast<std::size_t>(1), manager.getAllocatedBlockCount());
+            this->assert_equals(static_cast<std::size_t>(0), other.getAllocatedBlockCount());
+            this->assert_false(manager.adoptBlocks(pool, 1), "Pool blocks are not adopted.");
+            this->assert_false(pool.adoptBlocks(manager, 1), "Pool does not adopt heap blocks.");
+            this->assert_equals(static_cast<std::size_t>(1), pool.getAllocatedBlockCount());
+
+            manager.releaseMemory(ip);
+            pool.releaseMemory(pp);
+        }
+    };
+
+    /**
+     *  @brief Block aligned more strictly than new of the heap monitor on MSVC guarantees.
+     */
+    struct alignas(256) MemoryManagerTestOverAlignedBlock
+    {
+        int data_ = 0;
+    };
+
+    class MemoryManagerTestOverAligned : public LeafTest
+    {
+    public:
+        MemoryManagerTestOverAligned() :
+            LeafTest("over-aligned")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const std::size_t blockCount = 10;
+            const std::size_t alignment = alignof(MemoryManagerTestOverAlignedBlock);
+            std::vector<MemoryManagerTestOverAlignedBlock*> blocks;
+            mm::MemoryManager<MemoryManagerTestOverAlignedBlock> manager;
+
+            bool aligned = true;
+            for (std::size_t i = 0; i < blockCount; ++i)
+            {
+                blocks.push_back(manager.allocateMemory());
+                aligned = aligned && reinterpret_cast<std::uintptr_t>(blocks.back()) % alignment == 0;
+            }
+            this->assert_true(aligned, "Over-aligned blocks are aligned.");
+
+            for (auto* block : blocks)
+            {
+                manager.releaseMemory(block);
+            }
+            this->assert_equals(static_cast<std::size_t>(0), manager.getAllocatedBlockCount());
+        }
+    };
+
     class MemoryManagerTest : public CompositeTest
     {
     public:
@@ -93,6 +164,8 @@ namespace ds::tests
             this->add_test(std::make_unique<MemoryManagerTestAllocate>());
             this->add_test(std::make_unique<MemoryManagerTestRelease>());
             this->add_test(std::make_unique<MemoryManagerTestCounts>());
+            this->add_test(std::make_unique<MemoryManagerTestAdopt>());
+            this->add_test(std::make_unique<MemoryManagerTestOverAligned>());
         }
     };
 }
\ No newline at end of file
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/memory_statistics.h>
+#include <libds/mm/compact_memory_manager.h>
+#include <libds/amt/explicit_sequence.h>
+#include <memory>
+#include <type_traits>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests statistics collected by the default memory manager.
+     */
+    class MemoryStatisticsTestMemoryManager : public LeafTest
+    {
+    public:
+        MemoryStatisticsTestMemoryManager() :
+            LeafTest("memory-manager")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::MemoryManager<int> manager;
+            int* first = manager.allocateMemory();
+            int* second = manager.allocateMemory();
+            int* third = manager.allocateMemory();
+            manager.releaseMemory(first);
+
+            const mm::MemoryStatistics statistics = manager.getStatistics();
+            manager.releaseMemory(second);
+            manager.releaseMemory(third);
+            if (!mm::MemoryStatisticsRecorder<int>::ENABLED)
+            {
+                this->assert_equals(static_cast<size_t>(0), statistics.allocationCount_);
+                return;
+            }
+
+            this->assert_equals(static_cast<size_t>(3), statistics.allocationCount_);
+            this->assert_equals(static_cast<size_t>(1), statistics.releaseCount_);
+            this->assert_equals(static_cast<size_t>(2), statistics.liveBlockCount_);
+            this->assert_equals(static_cast<size_t>(3), statistics.peakBlockCount_);
+            this->assert_equals(2 * sizeof(int), statistics.usedBytes_);
+            this->assert_equals(2 * sizeof(int), statistics.reservedBytes_);
+        }
+    };
+
+    /**
+     * @brief Tests statistics collected by the compact memory manager.
+     */
+    class MemoryStatisticsTestCompactMemoryManager : public LeafTest
+    {
+    public:
+        MemoryStatisticsTestCompactMemoryManager() :
+            LeafTest("compact-memory-manager")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::CompactMemoryManager<int> manager(2);
+            manager.allocateMemory();
+            manager.allocateMemory();
+            manager.allocateMemory();
+            manager.allocateMemoryAt(0);
+            manager.releaseMemoryAt(0);
+
+            const mm::MemoryStatistics statistics = manager.getStatistics();
+            if (!mm::MemoryStatisticsRecorder<int>::ENABLED)
+            {
+                this->assert_equals(static_cast<size_t>(0), statistics.capacityChangeCount_);
+                return;
+            }
+
+            this->assert_equals(static_cast<size_t>(4), statistics.allocationCount_);
+            this->assert_equals(static_cast<size_t>(1), statistics.releaseCount_);
+            this->assert_equals(static_cast<size_t>(4), statistics.peakBlockCount_);
+            this->assert_equals(static_cast<size_t>(1), statistics.capacityChangeCount_);
+            this->assert_equals(4 * sizeof(int), statistics.reservedBytes_);
+            this->assert_equals(3 * sizeof(int), statistics.usedBytes_);
+            this->assert_equals(6 * sizeof(int), statistics.movedBytes_);
+        }
+    };
+
+    /**
+     * @brief Tests snapshot of statistics taken from a structure.
+     */
+    class MemoryStatisticsTestStructure : public LeafTest
+    {
+    public:
+        MemoryStatisticsTestStructure() :
+            LeafTest("structure")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            amt::SinglyLS<int> sequence;
+            for (int i = 0; i < 5; ++i)
+            {
+                sequence.insertLast().data_ = i;
+            }
+            sequence.removeFirst();
+
+            const mm::MemoryStatistics statistics = sequence.getMemoryStatistics();
+            if (!mm::MemoryStatisticsRecorder<int>::ENABLED)
+            {
+                this->assert_equals(static_cast<size_t>(0), statistics.liveBlockCount_);
+                return;
+            }
+
+            this->assert_equals(sequence.size(), statistics.liveBlockCount_);
+            this->assert_equals(static_cast<size_t>(5), statistics.peakBlockCount_);
+            this->assert_equals(static_cast<size_t>(1), statistics.releaseCount_);
+        }
+    };
+
+    /**
+     * @brief Tests that a build without DS_MM_STATISTICS keeps no counters.
+     */
+    class MemoryStatisticsTestDisabled : public LeafTest
+    {
+    public:
+        MemoryStatisticsTestDisabled() :
+            LeafTest("disabled")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            if (mm::MemoryStatisticsRecorder<int>::ENABLED)
+            {
+                this->assert_false(std::is_empty_v<mm::MemoryStatisticsRecorder<int>>, "Recorder keeps counters.");
+                return;
+            }
+
+            if (!mm::AllocationProfilerHook<int>::ENABLED)
+            {
+                this->assert_true(std::is_empty_v<mm::MemoryStatisticsRecorder<int>>, "Recorder adds no data.");
+            }
+
+            mm::CompactMemoryManager<int> manager(2);
+            for (int i = 0; i < 10; ++i)
+            {
+                manager.allocateMemoryAt(0);
+            }
+            manager.releaseMemoryAt(0);
+            manager.changeCapacity(100);
+
+            const mm::MemoryStatistics statistics = manager.getStatistics();
+            this->assert_equals(static_cast<size_t>(0), statistics.allocationCount_);
+            this->assert_equals(static_cast<size_t>(0), statistics.releaseCount_);
+            this->assert_equals(static_cast<size_t>(0), statistics.liveBlockCount_);
+            this->assert_equals(static_cast<size_t>(0), statistics.peakBlockCount_);
+            this->assert_equals(static_cast<size_t>(0), statistics.reservedBytes_);
+            this->assert_equals(static_cast<size_t>(0), statistics.usedBytes_);
+            this->assert_equals(static_cast<size_t>(0), statistics.capacityChangeCount_);
+            this->assert_equals(static_cast<size_t>(0), statistics.movedBytes_);
+        }
+    };
+
+    /**
+     * @brief All MemoryStatistics tests.
+     */
+    class MemoryStatisticsTest : public CompositeTest
+    {
+    public:
+        MemoryStatisticsTest() :
+            CompositeTest("MemoryStatistics")
+        {
+            this->add_test(std::make_unique<MemoryStatisticsTestMemoryManager>());
+            this->add_test(std::make_unique<MemoryStatisticsTestCompactMemoryManager>());
+            this->add_test(std::make_unique<MemoryStatisticsTestStructure>());
+            this->add_test(std::make_unique<MemoryStatisticsTestDisabled>());
+        }
+    };
+}
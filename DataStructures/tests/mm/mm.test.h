@@ -3,6 +3,12 @@
 #include <tests/_details/test.hpp>
 #include <tests/mm/memory_manager.test.h>
 #include <tests/mm/compact_memory_manager.test.h>
+#include <tests/mm/pool_memory_manager.test.h>
+#include <tests/mm/monotonic_arena_memory_manager.test.h>
+#include <tests/mm/memory_statistics.test.h>
+#include <tests/mm/growth_policy.test.h>
+#include <tests/mm/thread_caching_memory_manager.test.h>
+#include <tests/mm/allocation_profiler.test.h>
 #include <memory>
 
 namespace ds::tests
@@ -15,6 +21,12 @@ namespace ds::tests
         {
             this->add_test(std::make_unique<MemoryManagerTest>());
             this->add_test(std::make_unique<CompactMemoryManagerTest>());
+            this->add_test(std::make_unique<PoolMemoryManagerTest>());
+            this->add_test(std::make_unique<MonotonicArenaMemoryManagerTest>());
+            this->add_test(std::make_unique<MemoryStatisticsTest>());
+            this->add_test(std::make_unique<GrowthPolicyTest>());
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTest>());
+            this->add_test(std::make_unique<AllocationProfilerTest>());
         }
     };
 }
\ No newline at end of file
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/monotonic_arena_memory_manager.h>
+#include <libds/amt/explicit_sequence.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests allocation of consecutive blocks.
+     */
+    class MonotonicArenaMemoryManagerTestAllocate : public LeafTest
+    {
+    public:
+        MonotonicArenaMemoryManagerTestAllocate() :
+            LeafTest("allocate")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const size_t chunkCapacity = 4;
+            mm::MonotonicArenaMemoryManager<int> manager(chunkCapacity);
+
+            std::vector<int*> blocks;
+            for (size_t i = 0; i < 2 * chunkCapacity + 1; ++i)
+            {
+                int* ip = manager.allocateMemory();
+                *ip = static_cast<int>(i);
+                blocks.push_back(ip);
+            }
+
+            this->assert_equals(2 * chunkCapacity + 1, manager.getAllocatedBlockCount());
+            this->assert_equals(static_cast<size_t>(3), manager.getChunkCount());
+            this->assert_equals(blocks[0] + 1, blocks[1]);
+            for (size_t i = 0; i < blocks.size(); ++i)
+            {
+                this->assert_equals(static_cast<int>(i), *blocks[i]);
+            }
+        }
+    };
+
+    /**
+     * @brief Tests that memory is given back when the last block is released.
+     */
+    class MonotonicArenaMemoryManagerTestRelease : public LeafTest
+    {
+    public:
+        MonotonicArenaMemoryManagerTestRelease() :
+            LeafTest("release")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::MonotonicArenaMemoryManager<std::vector<int>> manager(2);
+            const size_t n = 5;
+
+            std::vector<std::vector<int>*> blocks;
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::vector<int>* block = manager.allocateMemory();
+                this->assert_true(block->empty(), "Allocated block is default constructed.");
+                block->assign(i + 1, static_cast<int>(i));
+                blocks.push_back(block);
+            }
+
+            for (std::vector<int>* block : blocks)
+            {
+                manager.releaseMemory(block);
+            }
+
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+            this->assert_equals(static_cast<size_t>(1), manager.getChunkCount());
+            this->assert_equals(blocks[0], manager.allocateMemory());
+            this->assert_equals(static_cast<size_t>(1), manager.getAllocatedBlockCount());
+        }
+    };
+
+    /**
+     * @brief Tests bulk release of all blocks.
+     */
+    class MonotonicArenaMemoryManagerTestReleaseAll : public LeafTest
+    {
+    public:
+        MonotonicArenaMemoryManagerTestReleaseAll() :
+            LeafTest("release-all")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::MonotonicArenaMemoryManager<int> manager(4);
+            int* first = manager.allocateMemory();
+            for (size_t i = 0; i < 10; ++i)
+            {
+                manager.allocateMemory();
+            }
+
+            manager.releaseAll();
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+            this->assert_equals(static_cast<size_t>(1), manager.getChunkCount());
+            this->assert_equals(first, manager.allocateMemory());
+        }
+    };
+
+    /**
+     * @brief Tests clearing of a sequence whose blocks are allocated by an arena.
+     */
+    class MonotonicArenaMemoryManagerTestSequenceClear : public LeafTest
+    {
+    public:
+        MonotonicArenaMemoryManagerTestSequenceClear() :
+            LeafTest("sequence-clear")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using BlockType = amt::DLSBlock<int>;
+            auto* manager = new mm::MonotonicArenaMemoryManager<BlockType>(4);
+            amt::DoublyLS<int> sequence(manager);
+
+            for (int i = 0; i < 10; ++i)
+            {
+                sequence.insertLast().data_ = i;
+            }
+            this->assert_equals(static_cast<size_t>(10), sequence.size());
+
+            sequence.clear();
+            this->assert_true(sequence.isEmpty(), "Sequence is empty.");
+            this->assert_equals(static_cast<size_t>(1), manager->getChunkCount());
+            this->assert_null(sequence.accessFirst());
+
+            sequence.insertFirst().data_ = 42;
+            this->assert_equals(42, sequence.accessFirst()->data_);
+            this->assert_equals(static_cast<size_t>(1), sequence.size());
+        }
+    };
+
+    /**
+     * @brief Tests that blocks are aligned to cache lines.
+     */
+    class MonotonicArenaMemoryManagerTestAlignment : public LeafTest
+    {
+    public:
+        MonotonicArenaMemoryManagerTestAlignment() :
+            LeafTest("alignment")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::MonotonicArenaMemoryManager<int> manager(4, mm::CACHE_LINE_SIZE);
+            this->assert_equals(mm::CACHE_LINE_SIZE, manager.getAlignment());
+
+            std::vector<int*> blocks;
+            for (int i = 0; i < 10; ++i)
+            {
+                int* block = manager.allocateMemory();
+                *block = i;
+                this->assert_equals(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(block) % mm::CACHE_LINE_SIZE);
+                blocks.push_back(block);
+            }
+
+            this->assert_equals(reinterpret_cast<std::uintptr_t>(blocks[0]) + mm::CACHE_LINE_SIZE, reinterpret_cast<std::uintptr_t>(blocks[1]));
+            for (int i = 0; i < 10; ++i)
+            {
+                this->assert_equals(i, *blocks[i]);
+                manager.releaseMemory(blocks[i]);
+            }
+        }
+    };
+
+    /**
+     * @brief All MonotonicArenaMemoryManager tests.
+     */
+    class MonotonicArenaMemoryManagerTest : public CompositeTest
+    {
+    public:
+        MonotonicArenaMemoryManagerTest() :
+            CompositeTest("MonotonicArenaMemoryManager")
+        {
+            this->add_test(std::make_unique<MonotonicArenaMemoryManagerTestAllocate>());
+            this->add_test(std::make_unique<MonotonicArenaMemoryManagerTestRelease>());
+            this->add_test(std::make_unique<MonotonicArenaMemoryManagerTestReleaseAll>());
+            this->add_test(std::make_unique<MonotonicArenaMemoryManagerTestSequenceClear>());
+            this->add_test(std::make_unique<MonotonicArenaMemoryManagerTestAlignment>());
+        }
+    };
+}
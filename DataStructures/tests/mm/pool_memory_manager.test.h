@@ -0,0 +1,164 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/pool_memory_manager.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests allocation of a single block.
+     */
+    class PoolMemoryManagerTestAllocate : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestAllocate() :
+            LeafTest("allocate")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PoolMemoryManager<int> manager;
+            int* ip = manager.allocateMemory();
+
+            const int data = 42;
+            *ip = data;
+            this->assert_equals(data, *ip);
+            this->assert_equals(static_cast<size_t>(1), manager.getAllocatedBlockCount());
+            manager.releaseMemory(ip);
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+        }
+    };
+
+    /**
+     * @brief Tests that released blocks are reused before a new slab is created.
+     */
+    class PoolMemoryManagerTestReuse : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestReuse() :
+            LeafTest("reuse")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const size_t slabCapacity = 4;
+            mm::PoolMemoryManager<int> manager(slabCapacity);
+
+            std::vector<int*> blocks;
+            for (size_t i = 0; i < slabCapacity; ++i)
+            {
+                blocks.push_back(manager.allocateMemory());
+            }
+            this->assert_equals(static_cast<size_t>(1), manager.getSlabCount());
+
+            int* released = blocks[1];
+            manager.releaseMemory(released);
+            int* reused = manager.allocateMemory();
+            this->assert_equals(released, reused);
+            this->assert_equals(static_cast<size_t>(1), manager.getSlabCount());
+
+            blocks.push_back(manager.allocateMemory());
+            this->assert_equals(static_cast<size_t>(2), manager.getSlabCount());
+
+            for (int* block : blocks)
+            {
+                manager.releaseMemory(block);
+            }
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+        }
+    };
+
+    /**
+     * @brief Tests that blocks are constructed and destructed.
+     */
+    class PoolMemoryManagerTestLifetime : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestLifetime() :
+            LeafTest("lifetime")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PoolMemoryManager<std::vector<int>> manager(2);
+            const size_t n = 10;
+
+            std::vector<std::vector<int>*> blocks;
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::vector<int>* block = manager.allocateMemory();
+                this->assert_true(block->empty(), "Allocated block is default constructed.");
+                block->assign(i + 1, static_cast<int>(i));
+                blocks.push_back(block);
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                this->assert_equals(i + 1, blocks[i]->size());
+                manager.releaseMemory(blocks[i]);
+            }
+
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+        }
+    };
+
+    /**
+     * @brief Tests that blocks are aligned to cache lines.
+     */
+    class PoolMemoryManagerTestAlignment : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestAlignment() :
+            LeafTest("alignment")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PoolMemoryManager<int> manager(4, mm::CACHE_LINE_SIZE);
+            this->assert_equals(mm::CACHE_LINE_SIZE, manager.getAlignment());
+
+            std::vector<int*> blocks;
+            for (int i = 0; i < 10; ++i)
+            {
+                int* block = manager.allocateMemory();
+                *block = i;
+                this->assert_equals(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(block) % mm::CACHE_LINE_SIZE);
+                blocks.push_back(block);
+            }
+
+            this->assert_equals(reinterpret_cast<std::uintptr_t>(blocks[0]) + mm::CACHE_LINE_SIZE, reinterpret_cast<std::uintptr_t>(blocks[1]));
+            for (int i = 0; i < 10; ++i)
+            {
+                this->assert_equals(i, *blocks[i]);
+                manager.releaseMemory(blocks[i]);
+            }
+        }
+    };
+
+    /**
+     * @brief All PoolMemoryManager tests.
+     */
+    class PoolMemoryManagerTest : public CompositeTest
+    {
+    public:
+        PoolMemoryManagerTest() :
+            CompositeTest("PoolMemoryManager")
+        {
+            this->add_test(std::make_unique<PoolMemoryManagerTestAllocate>());
+            this->add_test(std::make_unique<PoolMemoryManagerTestReuse>());
+            this->add_test(std::make_unique<PoolMemoryManagerTestLifetime>());
+            this->add_test(std::make_unique<PoolMemoryManagerTestAlignment>());
+        }
+    };
+}
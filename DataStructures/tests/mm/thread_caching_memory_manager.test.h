@@ -0,0 +1,155 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/thread_caching_memory_manager.h>
+#include <libds/amt/explicit_sequence.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests allocation and release of blocks.
+     */
+    class ThreadCachingMemoryManagerTestAllocate : public LeafTest
+    {
+    public:
+        ThreadCachingMemoryManagerTestAllocate() :
+            LeafTest("allocate")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using Manager = mm::ThreadCachingMemoryManager<std::vector<int>>;
+            Manager manager;
+            const size_t n = 3 * Manager::BATCH_SIZE;
+
+            std::vector<std::vector<int>*> blocks;
+            for (size_t i = 0; i < n; ++i)
+            {
+                std::vector<int>* block = manager.allocateMemory();
+                this->assert_true(block->empty(), "Allocated block is default constructed.");
+                block->assign(i + 1, static_cast<int>(i));
+                blocks.push_back(block);
+            }
+            this->assert_equals(n, manager.getAllocatedBlockCount());
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                this->assert_equals(i + 1, blocks[i]->size());
+                manager.releaseMemory(blocks[i]);
+            }
+
+            this->assert_equals(static_cast<size_t>(0), manager.getAllocatedBlockCount());
+            this->assert_true(Manager::getCachedBlockCount() < 2 * Manager::BATCH_SIZE, "Full batches are returned to the depot.");
+        }
+    };
+
+    /**
+     * @brief Tests that released blocks are reused by the same thread.
+     */
+    class ThreadCachingMemoryManagerTestReuse : public LeafTest
+    {
+    public:
+        ThreadCachingMemoryManagerTestReuse() :
+            LeafTest("reuse")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::ThreadCachingMemoryManager<int> manager;
+            int* released = manager.allocateMemory();
+            manager.releaseMemory(released);
+
+            int* reused = manager.allocateMemory();
+            this->assert_equals(released, reused);
+            manager.releaseMemory(reused);
+        }
+    };
+
+    /**
+     * @brief Tests sequences owned by concurrently running threads.
+     */
+    class ThreadCachingMemoryManagerTestThreads : public LeafTest
+    {
+    public:
+        ThreadCachingMemoryManagerTestThreads() :
+            LeafTest("threads")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using Sequence = amt::DoublyLS<int>;
+            using Manager = mm::ThreadCachingMemoryManager<amt::DLSBlock<int>>;
+            const int threadCount = 4;
+            const int n = 1000;
+            std::atomic<int> errorCount = 0;
+            std::vector<std::unique_ptr<Sequence>> handedOver(threadCount);
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < threadCount; ++t)
+            {
+                threads.emplace_back([&, t]()
+                    {
+                        Sequence sequence(new Manager());
+                        for (int round = 0; round < 10; ++round)
+                        {
+                            for (int i = 0; i < n; ++i)
+                            {
+                                sequence.insertLast().data_ = t * n + i;
+                            }
+                            for (int i = 0; i < n; ++i)
+                            {
+                                if (sequence.accessFirst()->data_ != t * n + i)
+                                {
+                                    ++errorCount;
+                                }
+                                sequence.removeFirst();
+                            }
+                        }
+
+                        handedOver[t] = std::make_unique<Sequence>(new Manager());
+                        for (int i = 0; i < n; ++i)
+                        {
+                            handedOver[t]->insertLast().data_ = i;
+                        }
+                    });
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            this->assert_equals(0, errorCount.load());
+            for (std::unique_ptr<Sequence>& sequence : handedOver)
+            {
+                this->assert_equals(static_cast<size_t>(n), sequence->size());
+                sequence.reset();
+            }
+        }
+    };
+
+    /**
+     * @brief All ThreadCachingMemoryManager tests.
+     */
+    class ThreadCachingMemoryManagerTest : public CompositeTest
+    {
+    public:
+        ThreadCachingMemoryManagerTest() :
+            CompositeTest("ThreadCachingMemoryManager")
+        {
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTestAllocate>());
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTestReuse>());
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTestThreads>());
+        }
+    };
+}
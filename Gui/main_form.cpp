@@ -1,8 +1,12 @@
 #include "main_form.h"
 
 #include <tests/root.h>
+#include <complexities/callable_analyzer.h>
+#include <complexities/hierarchy_analyzer.h>
 #include <complexities/list_analyzer.h>
+#include <complexities/memory_manager_analyzer.h>
 #include <complexities/table_analyzer.h>
+#include <complexities/table_lookup_analyzer.h>
 #include <msclr\marshal_cppstd.h>
 
 namespace WF = System::Windows::Forms;
@@ -62,6 +66,10 @@ std::vector<std::unique_ptr<ds::utils::Analyzer>> createAnalyzers()
 {
 	std::vector<std::unique_ptr<ds::utils::Analyzer>> analyzers;
 	analyzers.emplace_back(std::make_unique<ds::utils::ListsAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::MemoryManagersAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::CallablesAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::HierarchiesAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::TableLookupsAnalyzer>());
 	//analyzers.emplace_back(std::make_unique<ds::utils::TablesAnalyzer>());
 	return analyzers;
 }